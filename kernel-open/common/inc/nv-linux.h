@@ -1017,6 +1017,21 @@ static inline void *nv_kmem_cache_zalloc(struct kmem_cache *k, gfp_t flags)
 #endif
 }
 
+static inline void *nv_kmem_cache_zalloc_node(struct kmem_cache *k, gfp_t flags, int node)
+{
+    /*
+     * See nv_kmem_cache_zalloc() for why __GFP_ZERO isn't always used.
+     */
+#if defined(NV_KMEM_CACHE_HAS_KOBJ_REMOVE_WORK) && !defined(NV_SYSFS_SLAB_UNLINK_PRESENT)
+    void *object = kmem_cache_alloc_node(k, flags, node);
+    if (object)
+        memset(object, 0, kmem_cache_size(k));
+    return object;
+#else
+    return kmem_cache_alloc_node(k, flags | __GFP_ZERO, node);
+#endif
+}
+
 static inline int nv_kmem_cache_alloc_stack_atomic(nvidia_stack_t **stack)
 {
     nvidia_stack_t *sp = NULL;
@@ -4553,6 +4553,39 @@ compile_test() {
             compile_check_conftest "$CODE" "NV_MMU_NOTIFIER_OPS_HAS_ARCH_INVALIDATE_SECONDARY_TLBS" "" "types"
         ;;
 
+        shrinker_alloc)
+            #
+            # Determine if the shrinker_alloc() function is present.
+            #
+            # shrinker_alloc() was added by commit c42d50aefd17 ("mm:
+            # shrinker: add infrastructure for dynamically allocating
+            # shrinker") in v6.7. The same change removed register_shrinker().
+            #
+            CODE="
+            #include <linux/mm.h>
+            void conftest_shrinker_alloc(void) {
+                shrinker_alloc();
+            }"
+
+            compile_check_conftest "$CODE" "NV_SHRINKER_ALLOC_PRESENT" "" "functions"
+        ;;
+
+        register_shrinker_has_fmt_arg)
+            #
+            # Determine if register_shrinker() takes a name format argument.
+            #
+            # The argument was added by commit e33c267ab70d ("mm: shrinkers:
+            # provide shrinkers with names") in v6.0.
+            #
+            CODE="
+            #include <linux/mm.h>
+            int conftest_register_shrinker_has_fmt_arg(struct shrinker *s) {
+                return register_shrinker(s, \"%s\", \"conftest\");
+            }"
+
+            compile_check_conftest "$CODE" "NV_REGISTER_SHRINKER_HAS_FMT_ARG" "" "types"
+        ;;
+
         drm_format_num_planes)
             #
             # Determine if drm_format_num_planes() function is present.
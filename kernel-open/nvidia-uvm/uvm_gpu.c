@@ -718,6 +718,11 @@ gpu_fault_stats_print_common(uvm_parent_gpu_t *parent_gpu, struct seq_file *s)
                          parent_gpu->fault_buffer.replayable.stats.num_replays);
     UVM_SEQ_OR_DBG_PRINT(s, "  start_ack_all        %llu\n",
                          parent_gpu->fault_buffer.replayable.stats.num_replays_ack_all);
+    UVM_SEQ_OR_DBG_PRINT(s, "remote_numa_node:\n");
+    UVM_SEQ_OR_DBG_PRINT(s, "  batches              %llu\n",
+                         parent_gpu->fault_buffer.replayable.stats.num_remote_node_batches);
+    UVM_SEQ_OR_DBG_PRINT(s, "  va_blocks            %llu\n",
+                         parent_gpu->fault_buffer.replayable.stats.num_remote_node_va_blocks);
     UVM_SEQ_OR_DBG_PRINT(s, "non_replayable_faults  %llu\n", parent_gpu->stats.num_non_replayable_faults);
     UVM_SEQ_OR_DBG_PRINT(s, "faults_by_access_type:\n");
     UVM_SEQ_OR_DBG_PRINT(s, "  read                 %llu\n",
@@ -739,6 +744,11 @@ gpu_fault_stats_print_common(uvm_parent_gpu_t *parent_gpu, struct seq_file *s)
                          (num_pages_in * (NvU64)PAGE_SIZE) / (1024u * 1024u));
     UVM_SEQ_OR_DBG_PRINT(s, "  num_pages_out        %llu (%llu MB)\n", num_pages_out,
                          (num_pages_out * (NvU64)PAGE_SIZE) / (1024u * 1024u));
+    UVM_SEQ_OR_DBG_PRINT(s, "remote_numa_node:\n");
+    UVM_SEQ_OR_DBG_PRINT(s, "  batches              %llu\n",
+                         parent_gpu->fault_buffer.non_replayable.stats.num_remote_node_batches);
+    UVM_SEQ_OR_DBG_PRINT(s, "  va_blocks            %llu\n",
+                         parent_gpu->fault_buffer.non_replayable.stats.num_remote_node_va_blocks);
 }
 
 static void gpu_access_counters_print_common(uvm_parent_gpu_t *parent_gpu, struct seq_file *s)
@@ -1177,14 +1187,19 @@ static NV_STATUS find_unused_gpu_id(uvm_parent_gpu_t *parent_gpu, uvm_gpu_id_t *
 
 // Allocates a uvm_parent_gpu_t, assigns the GPU ID, and sets up basic data
 // structures, but leaves all other initialization up to the caller.
+//
+// The parent GPU embeds the fault servicing contexts used by the bottom halves,
+// so it's allocated on the NUMA node closest to the GPU, where the bottom
+// halves run.
 static NV_STATUS alloc_parent_gpu(const NvProcessorUuid *gpu_uuid,
                                   uvm_parent_gpu_id_t gpu_id,
+                                  int numa_node,
                                   uvm_parent_gpu_t **parent_gpu_out)
 {
     uvm_parent_gpu_t *parent_gpu;
     NV_STATUS status;
 
-    parent_gpu = uvm_kvmalloc_zero(sizeof(*parent_gpu));
+    parent_gpu = uvm_kvmalloc_zero_node(sizeof(*parent_gpu), numa_node);
     if (!parent_gpu)
         return NV_ERR_NO_MEMORY;
 
@@ -1218,12 +1233,12 @@ cleanup:
 
 // Allocates a uvm_gpu_t struct and initializes the basic fields and leaves all
 // other initialization up to the caller.
-static uvm_gpu_t *alloc_gpu(uvm_parent_gpu_t *parent_gpu, uvm_gpu_id_t gpu_id)
+static uvm_gpu_t *alloc_gpu(uvm_parent_gpu_t *parent_gpu, uvm_gpu_id_t gpu_id, int numa_node)
 {
     NvU32 sub_processor_index;
     uvm_gpu_t *gpu;
 
-    gpu = uvm_kvmalloc_zero(sizeof(*gpu));
+    gpu = uvm_kvmalloc_zero_node(sizeof(*gpu), numa_node);
     if (!gpu)
         return gpu;
 
@@ -2740,11 +2755,12 @@ static NV_STATUS add_gpu(const NvProcessorUuid *gpu_uuid,
     NV_STATUS status;
     bool alloc_parent = (parent_gpu == NULL);
     uvm_gpu_t *gpu = NULL;
+    int numa_node = dev_to_node(&gpu_platform_info->pci_dev->dev);
 
     uvm_assert_mutex_locked(&g_uvm_global.global_lock);
 
     if (alloc_parent) {
-        status = alloc_parent_gpu(gpu_uuid, uvm_parent_gpu_id_from_gpu_id(gpu_id), &parent_gpu);
+        status = alloc_parent_gpu(gpu_uuid, uvm_parent_gpu_id_from_gpu_id(gpu_id), numa_node, &parent_gpu);
         if (status != NV_OK)
             return status;
 
@@ -2752,7 +2768,7 @@ static NV_STATUS add_gpu(const NvProcessorUuid *gpu_uuid,
             parent_gpu->test = *parent_gpu_error;
     }
 
-    gpu = alloc_gpu(parent_gpu, gpu_id);
+    gpu = alloc_gpu(parent_gpu, gpu_id, numa_node);
     if (!gpu) {
         if (alloc_parent)
             uvm_parent_gpu_kref_put(parent_gpu);
@@ -402,6 +402,14 @@ typedef struct
             NvU64 num_replays;
 
             NvU64 num_replays_ack_all;
+
+            // Fault batches serviced on a CPU outside of closest_cpu_numa_node,
+            // so the batch context was accessed remotely.
+            NvU64 num_remote_node_batches;
+
+            // VA blocks serviced whose uvm_va_block_t is on a different NUMA
+            // node than the CPU servicing the faults.
+            NvU64 num_remote_node_va_blocks;
         } stats;
 
         // Number of uTLBs in the chip
@@ -448,6 +456,10 @@ typedef struct
             atomic64_t num_pages_out;
 
             atomic64_t num_pages_in;
+
+            NvU64 num_remote_node_batches;
+
+            NvU64 num_remote_node_va_blocks;
         } stats;
 
         // Tracker which temporarily holds the work pushed to service faults
@@ -1475,6 +1487,14 @@ static unsigned int uvm_gpu_numa_node(uvm_gpu_t *gpu)
     return gpu->mem_info.numa.node_id;
 }
 
+// Returns true if the calling thread runs on a CPU outside of the NUMA node
+// closest to the GPU, where the per-GPU fault servicing state is allocated.
+static bool uvm_parent_gpu_is_remote_numa_node(uvm_parent_gpu_t *parent_gpu)
+{
+    return parent_gpu->closest_cpu_numa_node != NUMA_NO_NODE &&
+           parent_gpu->closest_cpu_numa_node != numa_node_id();
+}
+
 static uvm_gpu_phys_address_t uvm_gpu_page_to_phys_address(uvm_gpu_t *gpu, struct page *page)
 {
     unsigned long sys_addr = page_to_pfn(page) << PAGE_SHIFT;
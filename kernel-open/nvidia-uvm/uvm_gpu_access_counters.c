@@ -395,8 +395,9 @@ NV_STATUS uvm_parent_gpu_init_access_counters(uvm_parent_gpu_t *parent_gpu, NvU3
         goto fail;
     }
 
-    batch_context->notification_cache = uvm_kvmalloc_zero(access_counters->max_notifications *
-                                                          sizeof(*batch_context->notification_cache));
+    batch_context->notification_cache = uvm_kvmalloc_zero_node(access_counters->max_notifications *
+                                                               sizeof(*batch_context->notification_cache),
+                                                               parent_gpu->closest_cpu_numa_node);
     if (!batch_context->notification_cache) {
         status = NV_ERR_NO_MEMORY;
         goto fail;
@@ -407,8 +408,9 @@ NV_STATUS uvm_parent_gpu_init_access_counters(uvm_parent_gpu_t *parent_gpu, NvU3
         goto fail;
     }
 
-    batch_context->notifications = uvm_kvmalloc_zero(access_counters->max_notifications *
-                                                     sizeof(*batch_context->notifications));
+    batch_context->notifications = uvm_kvmalloc_zero_node(access_counters->max_notifications *
+                                                          sizeof(*batch_context->notifications),
+                                                          parent_gpu->closest_cpu_numa_node);
     if (!batch_context->notifications) {
         status = NV_ERR_NO_MEMORY;
         goto fail;
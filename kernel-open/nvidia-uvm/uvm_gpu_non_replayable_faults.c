@@ -130,12 +130,14 @@ NV_STATUS uvm_parent_gpu_fault_buffer_init_non_replayable_faults(uvm_parent_gpu_
                                         parent_gpu->fault_buffer_hal->entry_size(parent_gpu);
 
     non_replayable_faults->shadow_buffer_copy =
-        uvm_kvmalloc_zero(parent_gpu->fault_buffer.rm_info.nonReplayable.bufferSize);
+        uvm_kvmalloc_zero_node(parent_gpu->fault_buffer.rm_info.nonReplayable.bufferSize,
+                               parent_gpu->closest_cpu_numa_node);
     if (!non_replayable_faults->shadow_buffer_copy)
         return NV_ERR_NO_MEMORY;
 
-    non_replayable_faults->fault_cache = uvm_kvmalloc_zero(non_replayable_faults->max_faults *
-                                                           sizeof(*non_replayable_faults->fault_cache));
+    non_replayable_faults->fault_cache = uvm_kvmalloc_zero_node(non_replayable_faults->max_faults *
+                                                                sizeof(*non_replayable_faults->fault_cache),
+                                                                parent_gpu->closest_cpu_numa_node);
     if (!non_replayable_faults->fault_cache)
         return NV_ERR_NO_MEMORY;
 
@@ -455,6 +457,9 @@ static NV_STATUS service_managed_fault_in_block(uvm_va_block_t *va_block,
     service_context->operation = UVM_SERVICE_OPERATION_NON_REPLAYABLE_FAULTS;
     service_context->num_retries = 0;
 
+    if (uvm_kvmalloc_nid(va_block) != numa_node_id())
+        ++gpu->parent->fault_buffer.non_replayable.stats.num_remote_node_va_blocks;
+
     if (uvm_va_block_is_hmm(va_block))
         uvm_hmm_migrate_begin_wait(va_block);
 
@@ -790,6 +795,9 @@ void uvm_parent_gpu_service_non_replayable_fault_buffer(uvm_parent_gpu_t *parent
         if (status != NV_OK)
             return;
 
+        if (cached_faults > 0 && uvm_parent_gpu_is_remote_numa_node(parent_gpu))
+            ++parent_gpu->fault_buffer.non_replayable.stats.num_remote_node_batches;
+
         // Differently to replayable faults, we do not batch up and preprocess
         // non-replayable faults since getting multiple faults on the same
         // memory region is not very likely
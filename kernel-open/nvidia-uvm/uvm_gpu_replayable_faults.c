@@ -164,22 +164,28 @@ static NV_STATUS fault_buffer_init_replayable_faults(uvm_parent_gpu_t *parent_gp
                        parent_gpu->fault_buffer.max_batch_size);
     }
 
-    batch_context->fault_cache = uvm_kvmalloc_zero(replayable_faults->max_faults * sizeof(*batch_context->fault_cache));
+    // The batch context is only accessed by the bottom half, so it's allocated
+    // on the node where the bottom half runs.
+    batch_context->fault_cache = uvm_kvmalloc_zero_node(replayable_faults->max_faults *
+                                                        sizeof(*batch_context->fault_cache),
+                                                        parent_gpu->closest_cpu_numa_node);
     if (!batch_context->fault_cache)
         return NV_ERR_NO_MEMORY;
 
     // fault_cache is used to signal that the tracker was initialized.
     uvm_tracker_init(&replayable_faults->replay_tracker);
 
-    batch_context->ordered_fault_cache = uvm_kvmalloc_zero(replayable_faults->max_faults *
-                                                           sizeof(*batch_context->ordered_fault_cache));
+    batch_context->ordered_fault_cache = uvm_kvmalloc_zero_node(replayable_faults->max_faults *
+                                                                sizeof(*batch_context->ordered_fault_cache),
+                                                                parent_gpu->closest_cpu_numa_node);
     if (!batch_context->ordered_fault_cache)
         return NV_ERR_NO_MEMORY;
 
     // This value must be initialized by HAL
     UVM_ASSERT(replayable_faults->utlb_count > 0);
 
-    batch_context->utlbs = uvm_kvmalloc_zero(replayable_faults->utlb_count * sizeof(*batch_context->utlbs));
+    batch_context->utlbs = uvm_kvmalloc_zero_node(replayable_faults->utlb_count * sizeof(*batch_context->utlbs),
+                                                  parent_gpu->closest_cpu_numa_node);
     if (!batch_context->utlbs)
         return NV_ERR_NO_MEMORY;
 
@@ -1619,6 +1625,9 @@ static NV_STATUS service_fault_batch_block(uvm_gpu_t *gpu,
     fault_block_context->operation = UVM_SERVICE_OPERATION_REPLAYABLE_FAULTS;
     fault_block_context->num_retries = 0;
 
+    if (uvm_kvmalloc_nid(va_block) != numa_node_id())
+        ++replayable_faults->stats.num_remote_node_va_blocks;
+
     if (uvm_va_block_is_hmm(va_block))
         uvm_hmm_migrate_begin_wait(va_block);
 
@@ -2939,6 +2948,9 @@ void uvm_parent_gpu_service_replayable_faults(uvm_parent_gpu_t *parent_gpu)
 
         ++batch_context->batch_id;
 
+        if (uvm_parent_gpu_is_remote_numa_node(parent_gpu))
+            ++replayable_faults->stats.num_remote_node_batches;
+
         status = preprocess_fault_batch(parent_gpu, batch_context);
 
         num_replays += batch_context->num_replays;
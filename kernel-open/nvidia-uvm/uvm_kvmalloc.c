@@ -246,7 +246,7 @@ static uvm_vmalloc_hdr_t *get_hdr(void *p)
     return hdr;
 }
 
-static void *alloc_internal(size_t size, bool zero_memory)
+static void *alloc_internal(size_t size, bool zero_memory, int nid)
 {
     uvm_vmalloc_hdr_t *hdr;
 
@@ -257,16 +257,18 @@ static void *alloc_internal(size_t size, bool zero_memory)
     // Make sure that (sizeof(hdr) + size) is what it should be
     BUILD_BUG_ON(sizeof(uvm_vmalloc_hdr_t) != offsetof(uvm_vmalloc_hdr_t, ptr));
 
+    // The _node variants with NUMA_NO_NODE are equivalent to the regular
+    // allocators, which prefer the node of the calling CPU.
     if (size <= UVM_KMALLOC_THRESHOLD) {
         if (zero_memory)
-            return kzalloc(size, NV_UVM_GFP_FLAGS);
-        return kmalloc(size, NV_UVM_GFP_FLAGS);
+            return kzalloc_node(size, NV_UVM_GFP_FLAGS, nid);
+        return kmalloc_node(size, NV_UVM_GFP_FLAGS, nid);
     }
 
     if (zero_memory)
-        hdr = vzalloc(sizeof(*hdr) + size);
+        hdr = vzalloc_node(sizeof(*hdr) + size, nid);
     else
-        hdr = vmalloc(sizeof(*hdr) + size);
+        hdr = vmalloc_node(sizeof(*hdr) + size, nid);
 
     if (!hdr)
         return NULL;
@@ -277,7 +279,7 @@ static void *alloc_internal(size_t size, bool zero_memory)
 
 void *__uvm_kvmalloc(size_t size, const char *file, int line, const char *function)
 {
-    void *p = alloc_internal(size, false);
+    void *p = alloc_internal(size, false, NUMA_NO_NODE);
 
     if (uvm_leak_checker && p)
         alloc_tracking_add(p, file, line, function);
@@ -287,7 +289,7 @@ void *__uvm_kvmalloc(size_t size, const char *file, int line, const char *functi
 
 void *__uvm_kvmalloc_zero(size_t size, const char *file, int line, const char *function)
 {
-    void *p = alloc_internal(size, true);
+    void *p = alloc_internal(size, true, NUMA_NO_NODE);
 
     if (uvm_leak_checker && p)
         alloc_tracking_add(p, file, line, function);
@@ -295,6 +297,34 @@ void *__uvm_kvmalloc_zero(size_t size, const char *file, int line, const char *f
     return p;
 }
 
+void *__uvm_kvmalloc_node(size_t size, int nid, const char *file, int line, const char *function)
+{
+    void *p = alloc_internal(size, false, nid);
+
+    if (uvm_leak_checker && p)
+        alloc_tracking_add(p, file, line, function);
+
+    return p;
+}
+
+void *__uvm_kvmalloc_zero_node(size_t size, int nid, const char *file, int line, const char *function)
+{
+    void *p = alloc_internal(size, true, nid);
+
+    if (uvm_leak_checker && p)
+        alloc_tracking_add(p, file, line, function);
+
+    return p;
+}
+
+int uvm_kvmalloc_nid(void *p)
+{
+    if (is_vmalloc_addr(p))
+        return page_to_nid(vmalloc_to_page(p));
+
+    return page_to_nid(virt_to_page(p));
+}
+
 void uvm_kvfree(void *p)
 {
     if (!p)
@@ -319,7 +349,7 @@ static void *realloc_from_kmalloc(void *p, size_t new_size)
         return krealloc(p, new_size, NV_UVM_GFP_FLAGS);
 
     // kmalloc -> vmalloc
-    new_p = alloc_internal(new_size, false);
+    new_p = alloc_internal(new_size, false, NUMA_NO_NODE);
     if (!new_p)
         return NULL;
     memcpy(new_p, p, min(ksize(p), new_size));
@@ -343,7 +373,7 @@ static void *realloc_from_vmalloc(void *p, size_t new_size)
 
     // vmalloc has no realloc functionality so we need to do a separate alloc +
     // copy.
-    new_p = alloc_internal(new_size, false);
+    new_p = alloc_internal(new_size, false, NUMA_NO_NODE);
     if (!new_p)
         return NULL;
 
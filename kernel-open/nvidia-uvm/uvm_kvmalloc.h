@@ -53,6 +53,21 @@ void *__uvm_kvmalloc_zero(size_t size, const char *file, int line, const char *f
 #define uvm_kvmalloc(__size) __uvm_kvmalloc(__size, __FILE__, __LINE__, __FUNCTION__)
 #define uvm_kvmalloc_zero(__size) __uvm_kvmalloc_zero(__size, __FILE__, __LINE__, __FUNCTION__)
 
+// Same as uvm_kvmalloc and uvm_kvmalloc_zero, but prefer allocating the memory
+// on NUMA node nid. This is only a preference and the memory may come from
+// another node if nid is short on memory. NUMA_NO_NODE prefers the node of the
+// calling CPU, like the non-_node variants.
+//
+// This is meant for long-lived structures mostly accessed by threads running
+// on a known node, like the per-GPU fault servicing state which is accessed by
+// the GPU's bottom half, see uvm_parent_gpu_t::closest_cpu_numa_node.
+void *__uvm_kvmalloc_node(size_t size, int nid, const char *file, int line, const char *function);
+void *__uvm_kvmalloc_zero_node(size_t size, int nid, const char *file, int line, const char *function);
+
+#define uvm_kvmalloc_node(__size, __nid) __uvm_kvmalloc_node(__size, __nid, __FILE__, __LINE__, __FUNCTION__)
+#define uvm_kvmalloc_zero_node(__size, __nid) \
+    __uvm_kvmalloc_zero_node(__size, __nid, __FILE__, __LINE__, __FUNCTION__)
+
 void uvm_kvfree(void *p);
 
 // Follows standard realloc semantics:
@@ -70,6 +85,12 @@ void *__uvm_kvrealloc(void *p, size_t new_size, const char *file, int line, cons
 // p must not be NULL.
 size_t uvm_kvsize(void *p);
 
+// Returns the NUMA node of the page backing p, which has to come from one of
+// the uvm_kvmalloc APIs or a kmem cache.
+//
+// p must not be NULL.
+int uvm_kvmalloc_nid(void *p);
+
 NV_STATUS uvm_test_kvmalloc(UVM_TEST_KVMALLOC_PARAMS *params, struct file *filp);
 
 #endif // __UVM_KVMALLOC_H__
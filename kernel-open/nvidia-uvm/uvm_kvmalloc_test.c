@@ -32,6 +32,8 @@ typedef enum
     ALLOC_TYPE_ZALLOC,
     ALLOC_TYPE_REALLOC_NULL,
     ALLOC_TYPE_REALLOC_ZERO,
+    ALLOC_TYPE_MALLOC_NODE,
+    ALLOC_TYPE_ZALLOC_NODE,
     ALLOC_TYPE_MAX
 } alloc_type_t;
 
@@ -83,6 +85,12 @@ static NV_STATUS test_uvm_kvmalloc(void)
                 case ALLOC_TYPE_REALLOC_ZERO:
                     p = uvm_kvrealloc(ZERO_SIZE_PTR, size);
                     break;
+                case ALLOC_TYPE_MALLOC_NODE:
+                    p = uvm_kvmalloc_node(size, numa_mem_id());
+                    break;
+                case ALLOC_TYPE_ZALLOC_NODE:
+                    p = uvm_kvmalloc_zero_node(size, numa_mem_id());
+                    break;
                 default:
                     UVM_ASSERT(0);
                     p = NULL;
@@ -95,8 +103,13 @@ static NV_STATUS test_uvm_kvmalloc(void)
             // reasonably free the allocation anyway.
             MEM_NV_CHECK_RET(check_alloc(p, size), NV_OK);
 
+            // The node is only a preference, so just check that the reported
+            // node is sane.
+            if (size != 0)
+                TEST_CHECK_RET(node_online(uvm_kvmalloc_nid(p)));
+
             // Scribble on the allocation to make sure we don't crash
-            if (alloc_type == ALLOC_TYPE_ZALLOC) {
+            if (alloc_type == ALLOC_TYPE_ZALLOC || alloc_type == ALLOC_TYPE_ZALLOC_NODE) {
                 expected = 0;
             }
             else {
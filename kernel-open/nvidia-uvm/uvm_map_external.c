@@ -87,11 +87,39 @@ typedef struct
 // some benchmarking on more systems though.
 #define MAX_PTE_BUFFER_SIZE ((size_t)96 * 1024)
 
+// Max size of a PTE buffer shared by several GPUs, see uvm_pte_cache_t. Such a
+// buffer is sized to hold all the PTEs of the mapping when possible, so RM is
+// only queried once for all the GPUs.
+#define MAX_SHARED_PTE_BUFFER_SIZE ((size_t)2 * 1024 * 1024)
+
+// PTEs queried from RM during a single UvmMapExternalAllocation call, shared
+// by all the mapping GPUs with the same parent GPU. The PTE format, and the
+// physical addressing of the allocation (peer IDs, DMA addresses), are
+// properties of the parent GPU, so SMC partitions mapping the allocation with
+// the same attributes and page size get the same PTEs from RM.
+typedef struct
+{
+    uvm_parent_gpu_t *parent;
+
+    uvm_map_rm_params_t map_rm_params;
+
+    // Only valid if parent is not NULL
+    uvm_pte_buffer_t pte_buffer;
+} uvm_pte_cache_entry_t;
+
+typedef struct
+{
+    uvm_pte_cache_entry_t *entries;
+
+    size_t num_entries;
+} uvm_pte_cache_t;
+
 static NV_STATUS uvm_pte_buffer_init(uvm_va_range_t *va_range,
                                      uvm_gpu_t *gpu,
                                      const uvm_map_rm_params_t *map_rm_params,
                                      NvU64 length,
                                      NvU64 page_size,
+                                     size_t max_buffer_size,
                                      uvm_pte_buffer_t *pte_buffer)
 {
     uvm_gpu_va_space_t *gpu_va_space = uvm_gpu_va_space_get(va_range->va_space, gpu);
@@ -114,7 +142,7 @@ static NV_STATUS uvm_pte_buffer_init(uvm_va_range_t *va_range,
     pte_buffer->pte_size = uvm_mmu_pte_size(tree, page_size);
     num_all_ptes = uvm_div_pow2_64(length, page_size);
     pte_buffer->max_pte_offset = uvm_div_pow2_64(map_rm_params->map_offset, page_size) + num_all_ptes;
-    pte_buffer->buffer_size = min(MAX_PTE_BUFFER_SIZE, num_all_ptes * pte_buffer->pte_size);
+    pte_buffer->buffer_size = min(max_buffer_size, num_all_ptes * pte_buffer->pte_size);
 
     pte_buffer->mapping_info.pteBuffer = uvm_kvmalloc(pte_buffer->buffer_size);
     if (!pte_buffer->mapping_info.pteBuffer)
@@ -364,16 +392,96 @@ static uvm_membar_t va_range_downgrade_membar(uvm_va_range_t *va_range, uvm_ext_
                                          !ext_gpu_map->is_sysmem && ext_gpu_map->gpu == ext_gpu_map->owning_gpu);
 }
 
-NV_STATUS uvm_va_range_map_rm_allocation(uvm_va_range_t *va_range,
-                                         uvm_gpu_t *mapping_gpu,
-                                         const UvmGpuMemoryInfo *mem_info,
-                                         const uvm_map_rm_params_t *map_rm_params,
-                                         uvm_ext_gpu_map_t *ext_gpu_map,
-                                         uvm_tracker_t *out_tracker)
+static bool map_rm_params_equal(const uvm_map_rm_params_t *a, const uvm_map_rm_params_t *b)
+{
+    return a->map_offset == b->map_offset &&
+           a->mapping_type == b->mapping_type &&
+           a->caching_type == b->caching_type &&
+           a->format_type == b->format_type &&
+           a->element_bits == b->element_bits &&
+           a->compression_type == b->compression_type;
+}
+
+// Return the shared PTE buffer to be used by mapping_gpu, initializing it if
+// this is the first GPU of its parent being mapped. NULL is returned if the
+// PTEs cannot be shared, in which case the caller uses a private buffer.
+static uvm_pte_buffer_t *pte_cache_get(uvm_pte_cache_t *pte_cache,
+                                       uvm_va_range_t *va_range,
+                                       uvm_gpu_t *mapping_gpu,
+                                       const uvm_map_rm_params_t *map_rm_params,
+                                       NvU64 length,
+                                       NvU64 page_size)
+{
+    uvm_pte_cache_entry_t *entry;
+    size_t i;
+
+    if (!pte_cache)
+        return NULL;
+
+    for (i = 0; i < pte_cache->num_entries; i++) {
+        entry = &pte_cache->entries[i];
+
+        if (!entry->parent)
+            break;
+
+        if (entry->parent != mapping_gpu->parent)
+            continue;
+
+        // A GPU of the same parent already initialized the entry with
+        // different attributes. Do not share.
+        if (!map_rm_params_equal(&entry->map_rm_params, map_rm_params) || entry->pte_buffer.page_size != page_size)
+            return NULL;
+
+        // Queries on buffer misses must use the current GPU, since the memory
+        // handle is duped on its device.
+        entry->pte_buffer.gpu = mapping_gpu;
+        return &entry->pte_buffer;
+    }
+
+    if (i == pte_cache->num_entries)
+        return NULL;
+
+    if (uvm_pte_buffer_init(va_range,
+                            mapping_gpu,
+                            map_rm_params,
+                            length,
+                            page_size,
+                            MAX_SHARED_PTE_BUFFER_SIZE,
+                            &entry->pte_buffer) != NV_OK) {
+        uvm_pte_buffer_deinit(&entry->pte_buffer);
+        return NULL;
+    }
+
+    entry->parent = mapping_gpu->parent;
+    entry->map_rm_params = *map_rm_params;
+
+    return &entry->pte_buffer;
+}
+
+static void pte_cache_deinit(uvm_pte_cache_t *pte_cache)
+{
+    size_t i;
+
+    for (i = 0; i < pte_cache->num_entries; i++) {
+        if (pte_cache->entries[i].parent)
+            uvm_pte_buffer_deinit(&pte_cache->entries[i].pte_buffer);
+    }
+
+    uvm_kvfree(pte_cache->entries);
+}
+
+static NV_STATUS va_range_map_rm_allocation(uvm_va_range_t *va_range,
+                                            uvm_gpu_t *mapping_gpu,
+                                            const UvmGpuMemoryInfo *mem_info,
+                                            const uvm_map_rm_params_t *map_rm_params,
+                                            uvm_ext_gpu_map_t *ext_gpu_map,
+                                            uvm_pte_cache_t *pte_cache,
+                                            uvm_tracker_t *out_tracker)
 {
     uvm_gpu_va_space_t *gpu_va_space = uvm_gpu_va_space_get(va_range->va_space, mapping_gpu);
     uvm_page_tree_t *page_tree;
-    uvm_pte_buffer_t pte_buffer;
+    uvm_pte_buffer_t local_pte_buffer;
+    uvm_pte_buffer_t *pte_buffer;
     uvm_page_table_range_vec_t *pt_range_vec;
     uvm_page_table_range_t *pt_range;
     uvm_range_tree_node_t *node;
@@ -425,14 +533,26 @@ NV_STATUS uvm_va_range_map_rm_allocation(uvm_va_range_t *va_range,
                IS_ALIGNED(node->end + 1, mem_info->pageSize) &&
                IS_ALIGNED(map_offset, mem_info->pageSize));
 
-    status = uvm_pte_buffer_init(va_range,
-                                 mapping_gpu,
-                                 map_rm_params,
-                                 uvm_range_tree_node_size(node),
-                                 mem_info->pageSize,
-                                 &pte_buffer);
-    if (status != NV_OK)
-        return status;
+    pte_buffer = pte_cache_get(pte_cache,
+                               va_range,
+                               mapping_gpu,
+                               map_rm_params,
+                               uvm_range_tree_node_size(node),
+                               mem_info->pageSize);
+    if (!pte_buffer) {
+        pte_buffer = &local_pte_buffer;
+        status = uvm_pte_buffer_init(va_range,
+                                     mapping_gpu,
+                                     map_rm_params,
+                                     uvm_range_tree_node_size(node),
+                                     mem_info->pageSize,
+                                     MAX_PTE_BUFFER_SIZE,
+                                     pte_buffer);
+        if (status != NV_OK) {
+            uvm_pte_buffer_deinit(pte_buffer);
+            return status;
+        }
+    }
 
     // Allocate all page tables for this VA range.
     //
@@ -457,7 +577,7 @@ NV_STATUS uvm_va_range_map_rm_allocation(uvm_va_range_t *va_range,
         // is used.
         status = map_rm_pt_range(page_tree,
                                  pt_range,
-                                 &pte_buffer,
+                                 pte_buffer,
                                  node,
                                  ext_gpu_map ? ext_gpu_map->mem_handle->rm_handle : 0,
                                  addr,
@@ -488,11 +608,23 @@ out:
         }
     }
 
-    uvm_pte_buffer_deinit(&pte_buffer);
+    if (pte_buffer == &local_pte_buffer)
+        uvm_pte_buffer_deinit(pte_buffer);
+
     uvm_tracker_deinit(&local_tracker);
     return status;
 }
 
+NV_STATUS uvm_va_range_map_rm_allocation(uvm_va_range_t *va_range,
+                                         uvm_gpu_t *mapping_gpu,
+                                         const UvmGpuMemoryInfo *mem_info,
+                                         const uvm_map_rm_params_t *map_rm_params,
+                                         uvm_ext_gpu_map_t *ext_gpu_map,
+                                         uvm_tracker_t *out_tracker)
+{
+    return va_range_map_rm_allocation(va_range, mapping_gpu, mem_info, map_rm_params, ext_gpu_map, NULL, out_tracker);
+}
+
 static bool uvm_api_mapping_type_invalid(UvmGpuMappingType map_type)
 {
     BUILD_BUG_ON((int)UvmGpuMappingTypeDefault != (int)UvmRmGpuMappingTypeDefault);
@@ -850,6 +982,7 @@ static NV_STATUS uvm_map_external_allocation_on_gpu(uvm_va_range_external_t *ext
                                                     const uvm_map_rm_params_t *map_rm_params,
                                                     NvU64 base,
                                                     NvU64 length,
+                                                    uvm_pte_cache_t *pte_cache,
                                                     uvm_tracker_t *out_tracker)
 {
     uvm_va_space_t *va_space = external_range->va_range.va_space;
@@ -959,12 +1092,13 @@ static NV_STATUS uvm_map_external_allocation_on_gpu(uvm_va_range_external_t *ext
 
     mem_info.pageSize = mapping_page_size;
 
-    status = uvm_va_range_map_rm_allocation(&external_range->va_range,
-                                            mapping_gpu,
-                                            &mem_info,
-                                            map_rm_params,
-                                            ext_gpu_map,
-                                            out_tracker);
+    status = va_range_map_rm_allocation(&external_range->va_range,
+                                        mapping_gpu,
+                                        &mem_info,
+                                        map_rm_params,
+                                        ext_gpu_map,
+                                        pte_cache,
+                                        out_tracker);
     if (status != NV_OK)
         goto error;
 
@@ -977,6 +1111,42 @@ error:
     return status;
 }
 
+// Set up PTE sharing if more than one of the requested GPUs have the same
+// parent GPU. Otherwise, or if the cache cannot be allocated, each GPU queries
+// its PTEs from RM independently.
+static void pte_cache_init(uvm_va_space_t *va_space,
+                           const UVM_MAP_EXTERNAL_ALLOCATION_PARAMS *params,
+                           uvm_pte_cache_t *pte_cache)
+{
+    uvm_parent_processor_mask_t parents;
+    bool shared_parent = false;
+    size_t i;
+
+    memset(pte_cache, 0, sizeof(*pte_cache));
+    uvm_parent_processor_mask_zero(&parents);
+
+    for (i = 0; i < params->gpuAttributesCount; i++) {
+        uvm_gpu_t *gpu = uvm_va_space_get_gpu_by_uuid_with_gpu_va_space(va_space,
+                                                                        &params->perGpuAttributes[i].gpuUuid);
+
+        // Invalid GPUs are reported when mapping
+        if (!gpu)
+            continue;
+
+        if (uvm_parent_processor_mask_test_and_set(&parents, gpu->parent->id)) {
+            shared_parent = true;
+            break;
+        }
+    }
+
+    if (!shared_parent)
+        return;
+
+    pte_cache->entries = uvm_kvmalloc_zero(params->gpuAttributesCount * sizeof(*pte_cache->entries));
+    if (pte_cache->entries)
+        pte_cache->num_entries = params->gpuAttributesCount;
+}
+
 // Actual implementation of UvmMapExternalAllocation
 static NV_STATUS uvm_map_external_allocation(uvm_va_space_t *va_space, UVM_MAP_EXTERNAL_ALLOCATION_PARAMS *params)
 {
@@ -993,6 +1163,7 @@ static NV_STATUS uvm_map_external_allocation(uvm_va_space_t *va_space, UVM_MAP_E
         .user_object   = params->hMemory
     };
     uvm_tracker_t tracker = UVM_TRACKER_INIT();
+    uvm_pte_cache_t pte_cache;
 
     if (uvm_api_range_invalid_4k(params->base, params->length))
         return NV_ERR_INVALID_ADDRESS;
@@ -1014,6 +1185,8 @@ static NV_STATUS uvm_map_external_allocation(uvm_va_space_t *va_space, UVM_MAP_E
         return NV_ERR_INVALID_ADDRESS;
     }
 
+    pte_cache_init(va_space, params, &pte_cache);
+
     uvm_processor_mask_zero(mapped_gpus);
     for (i = 0; i < params->gpuAttributesCount; i++) {
         if (uvm_api_mapping_type_invalid(params->perGpuAttributes[i].gpuMappingType) ||
@@ -1046,6 +1219,7 @@ static NV_STATUS uvm_map_external_allocation(uvm_va_space_t *va_space, UVM_MAP_E
                                                     &map_rm_params,
                                                     params->base,
                                                     params->length,
+                                                    &pte_cache,
                                                     &tracker);
         if (status != NV_OK)
             goto error;
@@ -1053,6 +1227,8 @@ static NV_STATUS uvm_map_external_allocation(uvm_va_space_t *va_space, UVM_MAP_E
         uvm_processor_mask_set(mapped_gpus, mapping_gpu->id);
     }
 
+    pte_cache_deinit(&pte_cache);
+
     // Wait for outstanding page table operations to finish across all GPUs. We
     // just need to hold the VA space lock to prevent the GPUs on which we're
     // waiting from getting unregistered underneath us.
@@ -1064,6 +1240,8 @@ static NV_STATUS uvm_map_external_allocation(uvm_va_space_t *va_space, UVM_MAP_E
     return status;
 
 error:
+    pte_cache_deinit(&pte_cache);
+
     // We still have to wait for page table writes to finish, since the teardown
     // could free them.
     (void)uvm_tracker_wait_deinit(&tracker);
@@ -1096,9 +1274,18 @@ NV_STATUS uvm_api_map_external_allocation(UVM_MAP_EXTERNAL_ALLOCATION_PARAMS *pa
     return uvm_map_external_allocation(va_space, params);
 }
 
-static NvU64 external_sparse_pte_maker(uvm_page_table_range_vec_t *range_vec, NvU64 offset, void *caller_data)
+// All sparse PTEs are the same, so the whole range is a single constant run
+static NvU64 external_sparse_pte_run_maker(uvm_page_table_range_vec_t *range_vec,
+                                           NvU64 offset,
+                                           NvU64 max_count,
+                                           NvU64 *pte_bits_out,
+                                           NvU64 *pte_bits_stride_out,
+                                           void *caller_data)
 {
-    return range_vec->tree->hal->make_sparse_pte();
+    *pte_bits_out = range_vec->tree->hal->make_sparse_pte();
+    *pte_bits_stride_out = 0;
+
+    return max_count;
 }
 
 static NV_STATUS uvm_map_external_sparse_on_gpu(uvm_va_range_external_t *external_range,
@@ -1159,10 +1346,10 @@ static NV_STATUS uvm_map_external_sparse_on_gpu(uvm_va_range_external_t *externa
     if (status != NV_OK)
         goto error;
 
-    status = uvm_page_table_range_vec_write_ptes(&ext_gpu_map->pt_range_vec,
-                                                 UVM_MEMBAR_NONE,
-                                                 external_sparse_pte_maker,
-                                                 NULL);
+    status = uvm_page_table_range_vec_write_pte_runs(&ext_gpu_map->pt_range_vec,
+                                                     UVM_MEMBAR_NONE,
+                                                     external_sparse_pte_run_maker,
+                                                     NULL);
     if (status != NV_OK)
         goto error;
 
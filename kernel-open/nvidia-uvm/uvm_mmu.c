@@ -2225,6 +2225,209 @@ NV_STATUS uvm_page_table_range_vec_write_ptes(uvm_page_table_range_vec_t *range_
         return uvm_page_table_range_vec_write_ptes_gpu(range_vec, tlb_membar, pte_maker, caller_data);
 }
 
+static NV_STATUS uvm_page_table_range_vec_write_pte_runs_cpu(uvm_page_table_range_vec_t *range_vec,
+                                                             uvm_membar_t tlb_membar,
+                                                             uvm_page_table_range_pte_run_maker_t pte_run_maker,
+                                                             void *caller_data)
+{
+    NV_STATUS status;
+    size_t i;
+    uvm_page_tree_t *tree = range_vec->tree;
+    NvU32 entry_size = uvm_mmu_pte_size(tree, range_vec->page_size);
+    uvm_push_t push;
+    NvU64 offset = 0;
+
+    UVM_ASSERT(uvm_mmu_use_cpu(tree));
+
+    // Enforce ordering with prior accesses to the pages being mapped before the
+    // mappings are activated.
+    mb();
+
+    for (i = 0; i < range_vec->range_count; ++i) {
+        uvm_page_table_range_t *range = &range_vec->ranges[i];
+        uvm_mmu_page_table_alloc_t *dir = &range->table->phys_alloc;
+        NvU32 entry = 0;
+
+        while (entry < range->entry_count) {
+            NvU64 pte_bits[2] = {0, 0};
+            NvU64 pte_bits_stride;
+            NvU64 count = pte_run_maker(range_vec,
+                                        offset,
+                                        range->entry_count - entry,
+                                        &pte_bits[0],
+                                        &pte_bits_stride,
+                                        caller_data);
+
+            UVM_ASSERT(count > 0 && count <= range->entry_count - entry);
+
+            if (entry_size == 8 && pte_bits_stride == 0) {
+                uvm_mmu_page_table_cpu_memset_8(tree->gpu, dir, range->start_index + entry, pte_bits[0], count);
+                entry += count;
+            }
+            else {
+                NvU32 run_end = entry + count;
+
+                for (; entry < run_end; ++entry) {
+                    if (entry_size == 8)
+                        uvm_mmu_page_table_cpu_memset_8(tree->gpu, dir, range->start_index + entry, pte_bits[0], 1);
+                    else
+                        uvm_mmu_page_table_cpu_memset_16(tree->gpu, dir, range->start_index + entry, pte_bits, 1);
+
+                    pte_bits[0] += pte_bits_stride;
+                }
+            }
+
+            offset += count * range_vec->page_size;
+        }
+    }
+
+    status = page_tree_begin_acquire(tree,
+                                     NULL,
+                                     &push,
+                                     "Invalidating [0x%llx, 0x%llx)",
+                                     range_vec->start,
+                                     range_vec->start + range_vec->size);
+    if (status != NV_OK)
+        return status;
+
+    uvm_tlb_batch_single_invalidate(tree, &push, range_vec->start, range_vec->size, range_vec->page_size, tlb_membar);
+    return page_tree_end_and_wait(tree, &push);
+}
+
+static NV_STATUS uvm_page_table_range_vec_write_pte_runs_gpu(uvm_page_table_range_vec_t *range_vec,
+                                                             uvm_membar_t tlb_membar,
+                                                             uvm_page_table_range_pte_run_maker_t pte_run_maker,
+                                                             void *caller_data)
+{
+    NV_STATUS status = NV_OK;
+    NV_STATUS tracker_status;
+    NvU32 entry;
+    size_t i;
+    uvm_page_tree_t *tree = range_vec->tree;
+    uvm_gpu_t *gpu = tree->gpu;
+    NvU32 entry_size = uvm_mmu_pte_size(tree, range_vec->page_size);
+
+    uvm_push_t push;
+    uvm_pte_batch_t pte_batch;
+    NvU64 offset = 0;
+    uvm_tracker_t tracker = UVM_TRACKER_INIT();
+    bool last_push = false;
+
+    // Use as much push space as possible leaving 1K of margin, same as
+    // uvm_page_table_range_vec_write_ptes_gpu().
+    static const NvU32 max_total_entry_size_per_push = UVM_MAX_PUSH_SIZE - 1024;
+
+    // Push space accounted for each memset of a constant run, including the
+    // flush of any inline PTEs preceding it. Generously rounded up.
+    static const NvU32 memset_run_push_size = 256;
+
+    UVM_ASSERT(!uvm_mmu_use_cpu(tree));
+
+    for (i = 0; i < range_vec->range_count; ++i) {
+        uvm_page_table_range_t *range = &range_vec->ranges[i];
+        NvU64 range_start = range_vec_calc_range_start(range_vec, i);
+        NvU64 range_size = range_vec_calc_range_size(range_vec, i);
+        uvm_gpu_phys_address_t entry_addr = uvm_page_table_range_entry_address(tree, range, 0);
+        entry = 0;
+
+        while (entry < range->entry_count) {
+            NvU32 push_size_left = max_total_entry_size_per_push;
+
+            status = page_tree_begin_acquire(tree,
+                                             &tracker,
+                                             &push,
+                                             "Writing PTE runs for range at [0x%llx, 0x%llx), subrange of range vec at [0x%llx, 0x%llx)",
+                                             range_start,
+                                             range_start + range_size,
+                                             range_vec->start,
+                                             range_vec->start + range_vec->size);
+            if (status != NV_OK) {
+                UVM_ERR_PRINT("Failed to begin push for writing PTE runs: %s GPU %s\n",
+                              nvstatusToString(status),
+                              uvm_gpu_name(gpu));
+                goto done;
+            }
+
+            uvm_pte_batch_begin(&push, &pte_batch);
+
+            while (entry < range->entry_count && push_size_left >= memset_run_push_size) {
+                NvU64 pte_bits;
+                NvU64 pte_bits_stride;
+                NvU64 count = pte_run_maker(range_vec,
+                                            offset,
+                                            range->entry_count - entry,
+                                            &pte_bits,
+                                            &pte_bits_stride,
+                                            caller_data);
+
+                UVM_ASSERT(count > 0 && count <= range->entry_count - entry);
+
+                if (pte_bits_stride != 0 || entry_size != sizeof(pte_bits) || count < UVM_PTE_BATCH_MIN_MEMSET_RUN) {
+                    // Runs expanded into inline data may be split across
+                    // pushes. The rest of the run is described again by
+                    // pte_run_maker() at the new offset.
+                    count = min(count, (NvU64)(push_size_left / entry_size));
+                    push_size_left -= count * entry_size;
+                }
+                else {
+                    push_size_left -= memset_run_push_size;
+                }
+
+                uvm_pte_batch_write_pte_run(&pte_batch, entry_addr, pte_bits, pte_bits_stride, entry_size, count);
+
+                entry += count;
+                offset += count * range_vec->page_size;
+                entry_addr.address += count * entry_size;
+            }
+
+            last_push = (i == range_vec->range_count - 1) && entry == range->entry_count;
+
+            uvm_pte_batch_end(&pte_batch);
+
+            if (last_push) {
+                // Invalidate TLBs as part of the last push
+                uvm_tlb_batch_single_invalidate(tree,
+                                                &push,
+                                                range_vec->start,
+                                                range_vec->size,
+                                                range_vec->page_size,
+                                                tlb_membar);
+            }
+            else {
+                // See uvm_page_table_range_vec_write_ptes_gpu()
+                uvm_push_set_flag(&push, UVM_PUSH_FLAG_NEXT_MEMBAR_NONE);
+            }
+
+            page_tree_end(tree, &push);
+
+            // Skip the tracking if in unit test mode
+            if (!tree->gpu->channel_manager)
+                continue;
+
+            // The push acquired the tracker so it's ok to just overwrite it with
+            // the entry tracking the push.
+            uvm_tracker_overwrite_with_push(&tracker, &push);
+        }
+    }
+
+done:
+    tracker_status = uvm_tracker_wait_deinit(&tracker);
+    if (status == NV_OK)
+        status = tracker_status;
+    return status;
+}
+
+NV_STATUS uvm_page_table_range_vec_write_pte_runs(uvm_page_table_range_vec_t *range_vec,
+                                                  uvm_membar_t tlb_membar,
+                                                  uvm_page_table_range_pte_run_maker_t pte_run_maker,
+                                                  void *caller_data)
+{
+    if (uvm_mmu_use_cpu(range_vec->tree))
+        return uvm_page_table_range_vec_write_pte_runs_cpu(range_vec, tlb_membar, pte_run_maker, caller_data);
+    else
+        return uvm_page_table_range_vec_write_pte_runs_gpu(range_vec, tlb_membar, pte_run_maker, caller_data);
+}
+
 typedef struct identity_mapping_pte_maker_data_struct
 {
     NvU64 phys_offset;
@@ -2241,6 +2444,36 @@ static NvU64 identity_mapping_pte_maker(uvm_page_table_range_vec_t *range_vec, N
                                           pte_flags);
 }
 
+// The identity mapping is physically contiguous, so its PTEs form a single
+// arithmetic run as long as the PTE address field grows linearly with the
+// physical address. That's checked on the last PTE of the run, falling back to
+// single PTE runs otherwise.
+static NvU64 identity_mapping_pte_run_maker(uvm_page_table_range_vec_t *range_vec,
+                                            NvU64 offset,
+                                            NvU64 max_count,
+                                            NvU64 *pte_bits_out,
+                                            NvU64 *pte_bits_stride_out,
+                                            void *data)
+{
+    NvU64 pte_bits = identity_mapping_pte_maker(range_vec, offset, data);
+    NvU64 last_pte_bits;
+    NvU64 stride;
+
+    *pte_bits_out = pte_bits;
+    *pte_bits_stride_out = 0;
+
+    if (max_count == 1)
+        return 1;
+
+    stride = identity_mapping_pte_maker(range_vec, offset + range_vec->page_size, data) - pte_bits;
+    last_pte_bits = identity_mapping_pte_maker(range_vec, offset + (max_count - 1) * range_vec->page_size, data);
+    if (last_pte_bits != pte_bits + (max_count - 1) * stride)
+        return 1;
+
+    *pte_bits_stride_out = stride;
+    return max_count;
+}
+
 static NV_STATUS create_identity_mapping(uvm_gpu_t *gpu,
                                          uvm_gpu_identity_mapping_t *mapping,
                                          NvU64 size,
@@ -2272,10 +2505,10 @@ static NV_STATUS create_identity_mapping(uvm_gpu_t *gpu,
         return status;
     }
 
-    status = uvm_page_table_range_vec_write_ptes(mapping->range_vec,
-                                                 UVM_MEMBAR_NONE,
-                                                 identity_mapping_pte_maker,
-                                                 &data);
+    status = uvm_page_table_range_vec_write_pte_runs(mapping->range_vec,
+                                                     UVM_MEMBAR_NONE,
+                                                     identity_mapping_pte_run_maker,
+                                                     &data);
     if (status != NV_OK) {
         UVM_ERR_PRINT("Failed to write PTEs for aperture %d identity mapping at [0x%llx, 0x%llx): %s, GPU %s\n",
                       aperture,
@@ -554,6 +554,34 @@ NV_STATUS uvm_page_table_range_vec_write_ptes(uvm_page_table_range_vec_t *range_
                                               uvm_page_table_range_pte_maker_t pte_maker,
                                               void *caller_data);
 
+// A PTE run making function used by uvm_page_table_range_vec_write_pte_runs()
+//
+// The function gets called with a page_size aligned offset within the VA
+// covered by the range vector and describes the PTEs starting at that offset
+// as an arithmetic run: the PTE for offset + i * page_size is
+// *pte_bits_out + i * *pte_bits_stride_out. It returns the number of PTEs in
+// the run, which has to be between 1 and max_count.
+// The caller_data pointer is what the caller passed in as caller_data to
+// uvm_page_table_range_vec_write_pte_runs().
+typedef NvU64 (*uvm_page_table_range_pte_run_maker_t)(uvm_page_table_range_vec_t *range_vec,
+                                                      NvU64 offset,
+                                                      NvU64 max_count,
+                                                      NvU64 *pte_bits_out,
+                                                      NvU64 *pte_bits_stride_out,
+                                                      void *caller_data);
+
+// Write all PTEs covered by the range vector using the given PTE run making
+// function.
+//
+// This is equivalent to uvm_page_table_range_vec_write_ptes(), but the PTEs are
+// described in runs rather than one at a time. Constant runs are written by the
+// GPU with a memset taking the same pushbuffer space regardless of the run
+// length, see uvm_pte_batch_write_pte_run().
+NV_STATUS uvm_page_table_range_vec_write_pte_runs(uvm_page_table_range_vec_t *range_vec,
+                                                  uvm_membar_t tlb_membar,
+                                                  uvm_page_table_range_pte_run_maker_t pte_run_maker,
+                                                  void *caller_data);
+
 // Set all PTEs covered by the range vector to an empty PTE
 //
 // After clearing all PTEs a TLB invalidate is performed including the given
@@ -28,6 +28,7 @@
 #include "uvm_hal.h"
 #include "uvm_tlb_batch.h"
 #include "uvm_mmu.h"
+#include "uvm_pte_batch.h"
 #include "uvm_kvmalloc.h"
 
 // MAXWELL_*
@@ -62,12 +63,19 @@
 #define BIG_PAGE_SIZE_PASCAL (1 << 16)
 #define MAX_NUM_PAGE_SIZES  (8)
 
+// Amount of CE work done by the fake CE, used for comparing the ways of writing
+// PTEs.
+static NvU64 g_fake_ce_memset_count;
+static NvU64 g_fake_ce_memcopy_bytes;
+
 static void fake_ce_memset_8(uvm_push_t *push, uvm_gpu_address_t dst, NvU64 value, size_t size)
 {
     size_t i;
 
     UVM_ASSERT(dst.aperture == UVM_APERTURE_SYS);
 
+    ++g_fake_ce_memset_count;
+
     for (i = 0; i < size; i += 8)
         *(NvU64 *)phys_to_virt(dst.address + i) = value;
 }
@@ -84,6 +92,8 @@ static void *cpu_addr_from_fake(uvm_gpu_address_t fake_gpu_addr)
 
 static void fake_ce_memcopy(uvm_push_t *push, uvm_gpu_address_t dst, uvm_gpu_address_t src, size_t size)
 {
+    g_fake_ce_memcopy_bytes += size;
+
     memcpy(cpu_addr_from_fake(dst), cpu_addr_from_fake(src), size);
 }
 
@@ -1512,6 +1522,166 @@ static NV_STATUS test_range_vec_clear_ptes(uvm_page_table_range_vec_t *range_vec
     return NV_OK;
 }
 
+// Length of the PTE runs made by test_pte_run_maker(). Runs alternate between
+// constant and arithmetic ones.
+#define TEST_PTE_RUN_LENGTH 100
+
+static NvU64 test_pte_run_expected(NvU64 index)
+{
+    NvU64 run = index / TEST_PTE_RUN_LENGTH;
+
+    if (run % 2 == 0)
+        return (run + 1) << 40;
+
+    return ((run + 1) << 40) + index * 0x100;
+}
+
+static NvU64 test_pte_maker(uvm_page_table_range_vec_t *range_vec, NvU64 offset, void *caller_data)
+{
+    return test_pte_run_expected(offset / range_vec->page_size);
+}
+
+static NvU64 test_pte_run_maker(uvm_page_table_range_vec_t *range_vec,
+                                NvU64 offset,
+                                NvU64 max_count,
+                                NvU64 *pte_bits_out,
+                                NvU64 *pte_bits_stride_out,
+                                void *caller_data)
+{
+    NvU64 index = offset / range_vec->page_size;
+
+    *pte_bits_out = test_pte_run_expected(index);
+    *pte_bits_stride_out = (index / TEST_PTE_RUN_LENGTH) % 2 == 0 ? 0 : 0x100;
+
+    return min(max_count, TEST_PTE_RUN_LENGTH - index % TEST_PTE_RUN_LENGTH);
+}
+
+static bool assert_range_vec_pte_runs(uvm_page_table_range_vec_t *range_vec)
+{
+    NvU32 i;
+    NvU32 entry;
+    NvU64 index = 0;
+
+    for (i = 0; i < range_vec->range_count; ++i) {
+        uvm_page_table_range_t *range = &range_vec->ranges[i];
+
+        for (entry = 0; entry < range->entry_count; ++entry) {
+            uvm_gpu_phys_address_t pte_addr = uvm_page_table_range_entry_address(range_vec->tree, range, entry);
+            NvU64 *pte = (NvU64*)phys_to_virt(pte_addr.address);
+            if (*pte != test_pte_run_expected(index)) {
+                UVM_TEST_PRINT("PTE is 0x%llx instead of 0x%llx for index %llu within range [0x%llx, 0x%llx)\n",
+                               *pte,
+                               test_pte_run_expected(index),
+                               index,
+                               range_vec->start,
+                               range_vec->size);
+                return false;
+            }
+            ++index;
+        }
+    }
+
+    return true;
+}
+
+// Write the PTEs of each range with a single uvm_pte_batch_write_ptes() call,
+// like the external mappings do with the PTEs queried from RM.
+static NV_STATUS test_range_vec_write_ptes_buffer(uvm_page_table_range_vec_t *range_vec)
+{
+    NV_STATUS status = NV_OK;
+    uvm_page_tree_t *tree = range_vec->tree;
+    NvU64 num_ptes = range_vec->size / range_vec->page_size;
+    NvU64 *pte_bits;
+    NvU64 index = 0;
+    NvU32 i;
+
+    pte_bits = uvm_kvmalloc(num_ptes * sizeof(*pte_bits));
+    if (!pte_bits)
+        return NV_ERR_NO_MEMORY;
+
+    for (i = 0; i < num_ptes; ++i)
+        pte_bits[i] = test_pte_run_expected(i);
+
+    for (i = 0; i < range_vec->range_count; ++i) {
+        uvm_page_table_range_t *range = &range_vec->ranges[i];
+        uvm_pte_batch_t batch;
+        uvm_push_t push;
+
+        TEST_NV_CHECK_GOTO(uvm_push_begin_fake(tree->gpu, &push), done);
+
+        uvm_pte_batch_begin(&push, &batch);
+        uvm_pte_batch_write_ptes(&batch,
+                                 uvm_page_table_range_entry_address(tree, range, 0),
+                                 pte_bits + index,
+                                 sizeof(*pte_bits),
+                                 range->entry_count);
+        uvm_pte_batch_end(&batch);
+
+        uvm_push_end_fake(&push);
+
+        index += range->entry_count;
+    }
+
+done:
+    uvm_kvfree(pte_bits);
+
+    return status;
+}
+
+// Compare writing PTEs one at a time with writing them as runs. The PTEs have
+// to end up the same, but the constant runs shouldn't be copied from inline
+// data.
+static NV_STATUS test_range_vec_pte_runs(uvm_page_tree_t *tree, NvU64 start, NvU64 size, NvU64 page_size)
+{
+    uvm_page_table_range_vec_t *range_vec;
+    uvm_pmm_alloc_flags_t pmm_flags = UVM_PMM_ALLOC_FLAGS_EVICT;
+    NvU64 memcopy_bytes_ptes;
+    NvU64 memcopy_bytes_runs;
+    NvU64 memset_count_runs;
+    NvU64 num_ptes = size / page_size;
+
+    TEST_CHECK_RET(uvm_page_table_range_vec_create(tree, start, size, page_size, pmm_flags, &range_vec) == NV_OK);
+
+    g_fake_ce_memset_count = 0;
+    g_fake_ce_memcopy_bytes = 0;
+    TEST_CHECK_RET(uvm_page_table_range_vec_write_ptes(range_vec, UVM_MEMBAR_NONE, test_pte_maker, NULL) == NV_OK);
+    TEST_CHECK_RET(assert_range_vec_pte_runs(range_vec));
+    memcopy_bytes_ptes = g_fake_ce_memcopy_bytes;
+
+    TEST_CHECK_RET(uvm_page_table_range_vec_clear_ptes(range_vec, UVM_MEMBAR_NONE) == NV_OK);
+    TEST_CHECK_RET(assert_range_vec_ptes(range_vec, true));
+
+    g_fake_ce_memset_count = 0;
+    g_fake_ce_memcopy_bytes = 0;
+    TEST_CHECK_RET(uvm_page_table_range_vec_write_pte_runs(range_vec, UVM_MEMBAR_NONE, test_pte_run_maker, NULL) == NV_OK);
+    TEST_CHECK_RET(assert_range_vec_pte_runs(range_vec));
+    memcopy_bytes_runs = g_fake_ce_memcopy_bytes;
+    memset_count_runs = g_fake_ce_memset_count;
+
+    // With no page table boundaries in the way, each full constant run is
+    // written with a memset and only the arithmetic runs are copied.
+    if (range_vec->range_count == 1 && num_ptes >= 2 * TEST_PTE_RUN_LENGTH) {
+        TEST_CHECK_RET(memset_count_runs >= num_ptes / (2 * TEST_PTE_RUN_LENGTH));
+        TEST_CHECK_RET(memcopy_bytes_runs + memset_count_runs * UVM_PTE_BATCH_MIN_MEMSET_RUN * sizeof(NvU64) <=
+                       memcopy_bytes_ptes);
+    }
+    else {
+        TEST_CHECK_RET(memcopy_bytes_runs <= memcopy_bytes_ptes);
+    }
+
+    // Writing the same PTEs from a buffer also finds the constant runs
+    TEST_CHECK_RET(uvm_page_table_range_vec_clear_ptes(range_vec, UVM_MEMBAR_NONE) == NV_OK);
+    g_fake_ce_memset_count = 0;
+    TEST_CHECK_RET(test_range_vec_write_ptes_buffer(range_vec) == NV_OK);
+    TEST_CHECK_RET(assert_range_vec_pte_runs(range_vec));
+    if (range_vec->range_count == 1 && num_ptes >= 2 * TEST_PTE_RUN_LENGTH)
+        TEST_CHECK_RET(g_fake_ce_memset_count == memset_count_runs);
+
+    uvm_page_table_range_vec_destroy(range_vec);
+
+    return NV_OK;
+}
+
 static NV_STATUS test_range_vec_create(uvm_page_tree_t *tree,
                                        NvU64 start,
                                        NvU64 size,
@@ -1673,6 +1843,15 @@ static NV_STATUS test_range_vec(uvm_gpu_t *gpu, NvU32 big_page_size, NvU64 page_
     uvm_page_table_range_vec_destroy(range_vec);
     uvm_page_table_range_vec_deinit(&upper_range_vec);
 
+    // PTE runs within a single page table extent
+    size = min(pde_coverage, 1000 * page_size);
+    TEST_CHECK_RET(test_range_vec_pte_runs(&tree, 0, size, page_size) == NV_OK);
+
+    // PTE runs crossing the page table extent boundary
+    size = min(pde_coverage, 300 * page_size);
+    start = pde_coverage - (size / page_size / 2) * page_size;
+    TEST_CHECK_RET(test_range_vec_pte_runs(&tree, start, size, page_size) == NV_OK);
+
     uvm_page_tree_deinit(&tree);
 
     return status;
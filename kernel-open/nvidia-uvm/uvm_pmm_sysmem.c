@@ -33,6 +33,446 @@ MODULE_PARM_DESC(uvm_cpu_chunk_allocation_sizes, "OR'ed value of all CPU chunk a
 
 static struct kmem_cache *g_reverse_page_map_cache __read_mostly;
 
+// Optional pool of pre-zeroed CPU pages, kept per NUMA node and per CPU chunk
+// size. It takes page allocation, compaction and zeroing off the critical
+// path of CPU chunk allocations, like the ones performed when evicting GPU
+// memory. A background worker refills the pool of a node once it drops below
+// the low watermark, and a shrinker returns the pooled pages to the kernel
+// under memory pressure.
+//
+// Pooled pages are not charged to any memory cgroup and are not allocated from
+// ZONE_MOVABLE, so allocations that require either bypass the pool.
+static unsigned uvm_cpu_chunk_pool_high_watermark = 0;
+module_param(uvm_cpu_chunk_pool_high_watermark, uint, S_IRUGO);
+MODULE_PARM_DESC(uvm_cpu_chunk_pool_high_watermark,
+                 "Number of pre-zeroed CPU chunks of each size kept per NUMA node. 0 disables the pool.");
+
+static unsigned uvm_cpu_chunk_pool_low_watermark = 0;
+module_param(uvm_cpu_chunk_pool_low_watermark, uint, S_IRUGO);
+MODULE_PARM_DESC(uvm_cpu_chunk_pool_low_watermark,
+                 "Number of CPU chunks of each size below which the pool is refilled. "
+                 "0 uses half of the high watermark.");
+
+// Number of jiffies during which the pool is not refilled after the shrinker
+// released pages from it.
+#define UVM_CPU_CHUNK_POOL_SHRINK_BACKOFF HZ
+
+// PAGE_SIZE, 64K and 2M
+#define UVM_CPU_CHUNK_POOL_NUM_SIZES 3
+
+typedef struct
+{
+    // Pre-zeroed pages, linked through page->lru
+    struct list_head pages;
+
+    unsigned long num_pooled;
+
+    atomic64_t hits;
+    atomic64_t direct_allocs;
+    atomic64_t refills;
+    atomic64_t shrunk;
+} uvm_cpu_chunk_pool_list_t;
+
+typedef struct
+{
+    int nid;
+
+    // The shrinker runs in contexts in which the UVM thread context is not
+    // available, so a "normal" spin lock is used.
+    spinlock_t lock;
+
+    uvm_cpu_chunk_pool_list_t lists[UVM_CPU_CHUNK_POOL_NUM_SIZES];
+
+    nv_kthread_q_item_t refill_q_item;
+} uvm_cpu_chunk_pool_node_t;
+
+static struct
+{
+    // Array of MAX_NUMNODES entries. Only nodes with both memory and CPUs
+    // have a pool; the rest of entries are NULL. The array is NULL if the pool
+    // is disabled.
+    uvm_cpu_chunk_pool_node_t **nodes;
+
+    unsigned low_watermark;
+    unsigned high_watermark;
+
+    nv_kthread_q_t refill_q;
+
+    unsigned long last_shrink_jiffies;
+
+    struct shrinker *shrinker;
+#if !defined(NV_SHRINKER_ALLOC_PRESENT)
+    struct shrinker shrinker_storage;
+#endif
+} g_cpu_chunk_pool;
+
+static uvm_chunk_size_t cpu_chunk_pool_index_to_size(unsigned index)
+{
+    static const uvm_chunk_size_t sizes[UVM_CPU_CHUNK_POOL_NUM_SIZES] = { PAGE_SIZE,
+                                                                          UVM_PAGE_SIZE_64K,
+                                                                          UVM_PAGE_SIZE_2M };
+
+    return sizes[index];
+}
+
+static unsigned cpu_chunk_pool_size_to_index(uvm_chunk_size_t size)
+{
+    unsigned index;
+
+    for (index = 0; index < UVM_CPU_CHUNK_POOL_NUM_SIZES; index++) {
+        if (cpu_chunk_pool_index_to_size(index) == size)
+            return index;
+    }
+
+    UVM_ASSERT_MSG(false, "Invalid CPU chunk size 0x%x\n", size);
+    return 0;
+}
+
+// Whether chunks of the given pool list are allocated. With 64K kernel pages,
+// the PAGE_SIZE and 64K lists are the same size, and only the first one is
+// used.
+static bool cpu_chunk_pool_index_is_used(unsigned index)
+{
+    uvm_chunk_size_t size = cpu_chunk_pool_index_to_size(index);
+
+    if (index > 0 && size == PAGE_SIZE)
+        return false;
+
+    return size & uvm_cpu_chunk_get_allocation_sizes();
+}
+
+static uvm_cpu_chunk_pool_node_t *cpu_chunk_pool_get_node(int nid)
+{
+    if (!g_cpu_chunk_pool.nodes)
+        return NULL;
+
+    if (nid == NUMA_NO_NODE)
+        nid = numa_mem_id();
+
+    UVM_ASSERT(nid >= 0 && nid < MAX_NUMNODES);
+
+    return g_cpu_chunk_pool.nodes[nid];
+}
+
+// Whether the current task has a non-default NUMA memory policy. Without a
+// node, alloc_pages() places the allocation according to that policy, while
+// the pool would serve it from the local node.
+static bool cpu_chunk_pool_task_has_mempolicy(void)
+{
+#if defined(CONFIG_NUMA)
+    return current->mempolicy != NULL;
+#else
+    return false;
+#endif
+}
+
+static struct page *cpu_chunk_pool_alloc_page(uvm_chunk_size_t alloc_size,
+                                              int nid,
+                                              uvm_cpu_chunk_alloc_flags_t alloc_flags)
+{
+    uvm_cpu_chunk_pool_node_t *pool_node = cpu_chunk_pool_get_node(nid);
+    uvm_cpu_chunk_pool_list_t *list;
+    struct page *page = NULL;
+    unsigned long num_pooled;
+
+    if (!pool_node)
+        return NULL;
+
+    list = &pool_node->lists[cpu_chunk_pool_size_to_index(alloc_size)];
+
+    if (alloc_flags & (UVM_CPU_CHUNK_ALLOC_FLAGS_ACCOUNT | UVM_CPU_CHUNK_ALLOC_FLAGS_ALLOW_MOVABLE)) {
+        atomic64_inc(&list->direct_allocs);
+        return NULL;
+    }
+
+    if (nid == NUMA_NO_NODE && cpu_chunk_pool_task_has_mempolicy()) {
+        atomic64_inc(&list->direct_allocs);
+        return NULL;
+    }
+
+    spin_lock(&pool_node->lock);
+
+    page = list_first_entry_or_null(&list->pages, struct page, lru);
+    if (page) {
+        list_del_init(&page->lru);
+        list->num_pooled--;
+    }
+
+    num_pooled = list->num_pooled;
+
+    spin_unlock(&pool_node->lock);
+
+    if (page)
+        atomic64_inc(&list->hits);
+    else
+        atomic64_inc(&list->direct_allocs);
+
+    if (num_pooled < g_cpu_chunk_pool.low_watermark)
+        nv_kthread_q_schedule_q_item(&g_cpu_chunk_pool.refill_q, &pool_node->refill_q_item);
+
+    return page;
+}
+
+static void cpu_chunk_pool_refill(uvm_cpu_chunk_pool_node_t *pool_node)
+{
+    unsigned index;
+
+    if (time_before(jiffies, READ_ONCE(g_cpu_chunk_pool.last_shrink_jiffies) + UVM_CPU_CHUNK_POOL_SHRINK_BACKOFF))
+        return;
+
+    for (index = 0; index < UVM_CPU_CHUNK_POOL_NUM_SIZES; index++) {
+        uvm_cpu_chunk_pool_list_t *list = &pool_node->lists[index];
+        uvm_chunk_size_t size = cpu_chunk_pool_index_to_size(index);
+        gfp_t gfp_flags = NV_UVM_GFP_FLAGS | GFP_HIGHUSER | __GFP_ZERO | __GFP_THISNODE | __GFP_NOWARN;
+
+        if (!cpu_chunk_pool_index_is_used(index))
+            continue;
+
+        // Same as in uvm_cpu_chunk_alloc_page(), avoid compacting memory for
+        // higher order allocations.
+        if (size > PAGE_SIZE)
+            gfp_flags |= __GFP_COMP | __GFP_NORETRY;
+
+        while (READ_ONCE(list->num_pooled) < g_cpu_chunk_pool.high_watermark) {
+            struct page *page = alloc_pages_node(pool_node->nid, gfp_flags, get_order(size));
+
+            if (!page)
+                break;
+
+            spin_lock(&pool_node->lock);
+            list_add_tail(&page->lru, &list->pages);
+            list->num_pooled++;
+            spin_unlock(&pool_node->lock);
+
+            atomic64_inc(&list->refills);
+        }
+    }
+}
+
+static void cpu_chunk_pool_refill_entry(void *args)
+{
+    UVM_ENTRY_VOID(cpu_chunk_pool_refill(args));
+}
+
+// Release up to max_pages base pages from the pool, starting with the largest
+// chunks. Returns the number of base pages released.
+static unsigned long cpu_chunk_pool_release(unsigned long max_pages)
+{
+    unsigned long freed = 0;
+    int nid;
+
+    for_each_possible_uvm_node(nid) {
+        uvm_cpu_chunk_pool_node_t *pool_node = g_cpu_chunk_pool.nodes[nid];
+        int index;
+
+        if (!pool_node)
+            continue;
+
+        for (index = UVM_CPU_CHUNK_POOL_NUM_SIZES - 1; index >= 0 && freed < max_pages; index--) {
+            uvm_cpu_chunk_pool_list_t *list = &pool_node->lists[index];
+            uvm_chunk_size_t size = cpu_chunk_pool_index_to_size(index);
+            struct page *page, *next;
+            LIST_HEAD(pages);
+
+            spin_lock(&pool_node->lock);
+
+            while (freed < max_pages && !list_empty(&list->pages)) {
+                list_move(list->pages.next, &pages);
+                list->num_pooled--;
+                freed += size / PAGE_SIZE;
+            }
+
+            spin_unlock(&pool_node->lock);
+
+            list_for_each_entry_safe(page, next, &pages, lru) {
+                list_del(&page->lru);
+                __free_pages(page, get_order(size));
+                atomic64_inc(&list->shrunk);
+            }
+        }
+    }
+
+    return freed;
+}
+
+static unsigned long cpu_chunk_pool_count_objects(struct shrinker *shrinker, struct shrink_control *sc)
+{
+    unsigned long num_pages = 0;
+    int nid;
+
+    for_each_possible_uvm_node(nid) {
+        uvm_cpu_chunk_pool_node_t *pool_node = g_cpu_chunk_pool.nodes[nid];
+        unsigned index;
+
+        if (!pool_node)
+            continue;
+
+        for (index = 0; index < UVM_CPU_CHUNK_POOL_NUM_SIZES; index++) {
+            size_t chunk_pages = cpu_chunk_pool_index_to_size(index) / PAGE_SIZE;
+
+            num_pages += READ_ONCE(pool_node->lists[index].num_pooled) * chunk_pages;
+        }
+    }
+
+    return num_pages;
+}
+
+static unsigned long cpu_chunk_pool_scan_objects(struct shrinker *shrinker, struct shrink_control *sc)
+{
+    unsigned long freed;
+
+    WRITE_ONCE(g_cpu_chunk_pool.last_shrink_jiffies, jiffies);
+
+    freed = cpu_chunk_pool_release(sc->nr_to_scan);
+
+    return freed ? freed : SHRINK_STOP;
+}
+
+static void cpu_chunk_pool_register_shrinker(void)
+{
+    // A failure to register the shrinker is not fatal: the pool is still
+    // bounded by the high watermark.
+#if defined(NV_SHRINKER_ALLOC_PRESENT)
+    g_cpu_chunk_pool.shrinker = shrinker_alloc(0, "nvidia-uvm-cpu-chunk-pool");
+    if (!g_cpu_chunk_pool.shrinker)
+        return;
+
+    g_cpu_chunk_pool.shrinker->count_objects = cpu_chunk_pool_count_objects;
+    g_cpu_chunk_pool.shrinker->scan_objects = cpu_chunk_pool_scan_objects;
+    g_cpu_chunk_pool.shrinker->seeks = DEFAULT_SEEKS;
+
+    shrinker_register(g_cpu_chunk_pool.shrinker);
+#else
+    g_cpu_chunk_pool.shrinker = &g_cpu_chunk_pool.shrinker_storage;
+    g_cpu_chunk_pool.shrinker->count_objects = cpu_chunk_pool_count_objects;
+    g_cpu_chunk_pool.shrinker->scan_objects = cpu_chunk_pool_scan_objects;
+    g_cpu_chunk_pool.shrinker->seeks = DEFAULT_SEEKS;
+
+#if defined(NV_REGISTER_SHRINKER_HAS_FMT_ARG)
+    register_shrinker(g_cpu_chunk_pool.shrinker, "nvidia-uvm-cpu-chunk-pool");
+#else
+    register_shrinker(g_cpu_chunk_pool.shrinker);
+#endif
+#endif
+}
+
+static void cpu_chunk_pool_unregister_shrinker(void)
+{
+    if (!g_cpu_chunk_pool.shrinker)
+        return;
+
+#if defined(NV_SHRINKER_ALLOC_PRESENT)
+    shrinker_free(g_cpu_chunk_pool.shrinker);
+#else
+    unregister_shrinker(g_cpu_chunk_pool.shrinker);
+#endif
+
+    g_cpu_chunk_pool.shrinker = NULL;
+}
+
+static void cpu_chunk_pool_exit(void)
+{
+    int nid;
+
+    if (!g_cpu_chunk_pool.nodes)
+        return;
+
+    cpu_chunk_pool_unregister_shrinker();
+    nv_kthread_q_stop(&g_cpu_chunk_pool.refill_q);
+
+    cpu_chunk_pool_release(ULONG_MAX);
+
+    for_each_possible_uvm_node(nid)
+        uvm_kvfree(g_cpu_chunk_pool.nodes[nid]);
+
+    uvm_kvfree(g_cpu_chunk_pool.nodes);
+    g_cpu_chunk_pool.nodes = NULL;
+}
+
+static NV_STATUS cpu_chunk_pool_init(void)
+{
+    NV_STATUS status;
+    int nid;
+
+    if (uvm_cpu_chunk_pool_high_watermark == 0)
+        return NV_OK;
+
+    g_cpu_chunk_pool.high_watermark = uvm_cpu_chunk_pool_high_watermark;
+    g_cpu_chunk_pool.low_watermark = uvm_cpu_chunk_pool_low_watermark;
+    if (g_cpu_chunk_pool.low_watermark == 0 || g_cpu_chunk_pool.low_watermark > g_cpu_chunk_pool.high_watermark) {
+        if (uvm_cpu_chunk_pool_low_watermark != 0) {
+            UVM_INFO_PRINT("Invalid value for uvm_cpu_chunk_pool_low_watermark = %u, using %u instead\n",
+                           uvm_cpu_chunk_pool_low_watermark,
+                           g_cpu_chunk_pool.high_watermark / 2);
+        }
+
+        g_cpu_chunk_pool.low_watermark = g_cpu_chunk_pool.high_watermark / 2;
+    }
+
+    status = errno_to_nv_status(nv_kthread_q_init(&g_cpu_chunk_pool.refill_q, "UVM CPU chunk pool"));
+    if (status != NV_OK)
+        return status;
+
+    g_cpu_chunk_pool.nodes = uvm_kvmalloc_zero(MAX_NUMNODES * sizeof(*g_cpu_chunk_pool.nodes));
+    if (!g_cpu_chunk_pool.nodes) {
+        nv_kthread_q_stop(&g_cpu_chunk_pool.refill_q);
+        return NV_ERR_NO_MEMORY;
+    }
+
+    // Nodes without CPUs, like the ones onlined from coherent GPU memory, are
+    // not worth pre-populating.
+    for_each_possible_uvm_node(nid) {
+        uvm_cpu_chunk_pool_node_t *pool_node;
+        unsigned index;
+
+        if (!node_state(nid, N_MEMORY) || !node_state(nid, N_CPU))
+            continue;
+
+        pool_node = uvm_kvmalloc_zero(sizeof(*pool_node));
+        if (!pool_node) {
+            cpu_chunk_pool_exit();
+            return NV_ERR_NO_MEMORY;
+        }
+
+        pool_node->nid = nid;
+        spin_lock_init(&pool_node->lock);
+        for (index = 0; index < UVM_CPU_CHUNK_POOL_NUM_SIZES; index++)
+            INIT_LIST_HEAD(&pool_node->lists[index].pages);
+
+        nv_kthread_q_item_init(&pool_node->refill_q_item, cpu_chunk_pool_refill_entry, pool_node);
+
+        g_cpu_chunk_pool.nodes[nid] = pool_node;
+    }
+
+    cpu_chunk_pool_register_shrinker();
+
+    for_each_possible_uvm_node(nid) {
+        if (g_cpu_chunk_pool.nodes[nid])
+            nv_kthread_q_schedule_q_item(&g_cpu_chunk_pool.refill_q, &g_cpu_chunk_pool.nodes[nid]->refill_q_item);
+    }
+
+    return NV_OK;
+}
+
+bool uvm_cpu_chunk_pool_get_stats(int nid, uvm_chunk_size_t size, uvm_cpu_chunk_pool_stats_t *stats)
+{
+    uvm_cpu_chunk_pool_node_t *pool_node = cpu_chunk_pool_get_node(nid);
+    uvm_cpu_chunk_pool_list_t *list;
+
+    if (!pool_node)
+        return false;
+
+    list = &pool_node->lists[cpu_chunk_pool_size_to_index(size)];
+
+    stats->num_pooled = READ_ONCE(list->num_pooled);
+    stats->hits = atomic64_read(&list->hits);
+    stats->direct_allocs = atomic64_read(&list->direct_allocs);
+    stats->refills = atomic64_read(&list->refills);
+    stats->shrunk = atomic64_read(&list->shrunk);
+
+    return true;
+}
+
 NV_STATUS uvm_pmm_sysmem_init(void)
 {
     g_reverse_page_map_cache = NV_KMEM_CACHE_CREATE("uvm_pmm_sysmem_page_reverse_map_t",
@@ -49,11 +489,12 @@ NV_STATUS uvm_pmm_sysmem_init(void)
         uvm_cpu_chunk_allocation_sizes = UVM_CPU_CHUNK_SIZES;
     }
 
-    return NV_OK;
+    return cpu_chunk_pool_init();
 }
 
 void uvm_pmm_sysmem_exit(void)
 {
+    cpu_chunk_pool_exit();
     kmem_cache_destroy_safe(&g_reverse_page_map_cache);
 }
 
@@ -821,6 +1262,10 @@ static struct page *uvm_cpu_chunk_alloc_page(uvm_chunk_size_t alloc_size,
     UVM_ASSERT(is_power_of_2(alloc_size));
     UVM_ASSERT(alloc_size & uvm_cpu_chunk_get_allocation_sizes());
 
+    page = cpu_chunk_pool_alloc_page(alloc_size, nid, alloc_flags);
+    if (page)
+        goto done;
+
     if (alloc_flags & UVM_CPU_CHUNK_ALLOC_FLAGS_ACCOUNT)
         kernel_alloc_flags = NV_UVM_GFP_FLAGS_ACCOUNT;
     else
@@ -853,6 +1298,7 @@ static struct page *uvm_cpu_chunk_alloc_page(uvm_chunk_size_t alloc_size,
         page = alloc_pages_node(nid, kernel_alloc_flags, get_order(alloc_size));
     }
 
+done:
     if (page) {
         if (alloc_flags & UVM_CPU_CHUNK_ALLOC_FLAGS_ZERO)
             SetPageDirty(page);
@@ -266,6 +266,32 @@ typedef struct
 // Return the set of allowed CPU chunk allocation sizes.
 uvm_chunk_sizes_mask_t uvm_cpu_chunk_get_allocation_sizes(void);
 
+typedef struct
+{
+    // Number of pre-zeroed chunks currently in the pool
+    NvU64 num_pooled;
+
+    // Number of chunk allocations served from the pool
+    NvU64 hits;
+
+    // Number of chunk allocations served by the kernel, either because the
+    // pool was empty or because the allocation flags are not compatible with
+    // pooled pages
+    NvU64 direct_allocs;
+
+    // Number of chunks added to the pool by the background worker
+    NvU64 refills;
+
+    // Number of chunks returned to the kernel by the shrinker
+    NvU64 shrunk;
+} uvm_cpu_chunk_pool_stats_t;
+
+// Get the statistics of the pool of pre-zeroed CPU chunks of the given size
+// on the given NUMA node. NUMA_NO_NODE refers to the local memory node.
+// Returns false if the pool is disabled, see
+// uvm_cpu_chunk_pool_high_watermark, or the node has no pool.
+bool uvm_cpu_chunk_pool_get_stats(int nid, uvm_chunk_size_t size, uvm_cpu_chunk_pool_stats_t *stats);
+
 // Allocate a physical CPU chunk of the specified size.
 //
 // The nid argument is used to indicate a memory node preference. If the
@@ -1349,6 +1349,41 @@ static NV_STATUS test_cpu_chunk_numa_alloc(uvm_va_space_t *va_space)
     return NV_OK;
 }
 
+// Allocations compatible with the pool of pre-zeroed chunks, if enabled, are
+// either served from the pool, or accounted as direct allocations.
+static NV_STATUS test_cpu_chunk_pool(void)
+{
+    uvm_chunk_sizes_mask_t alloc_sizes = uvm_cpu_chunk_get_allocation_sizes();
+    size_t size;
+
+    for_each_chunk_size(size, alloc_sizes) {
+        int nid;
+
+        for_each_possible_uvm_node(nid) {
+            uvm_cpu_chunk_pool_stats_t stats_before, stats_after;
+            uvm_cpu_chunk_t *chunk;
+
+            if (!uvm_cpu_chunk_pool_get_stats(nid, size, &stats_before))
+                continue;
+
+            TEST_NV_CHECK_RET(test_cpu_chunk_alloc(size,
+                                                   UVM_CPU_CHUNK_ALLOC_FLAGS_ZERO | UVM_CPU_CHUNK_ALLOC_FLAGS_STRICT,
+                                                   nid,
+                                                   &chunk));
+            uvm_cpu_chunk_free(chunk);
+
+            TEST_CHECK_RET(uvm_cpu_chunk_pool_get_stats(nid, size, &stats_after));
+            TEST_CHECK_RET(stats_after.hits + stats_after.direct_allocs >
+                           stats_before.hits + stats_before.direct_allocs);
+
+            TEST_NV_CHECK_RET(test_cpu_chunk_alloc(size, UVM_CPU_CHUNK_ALLOC_FLAGS_STRICT, nid, &chunk));
+            uvm_cpu_chunk_free(chunk);
+        }
+    }
+
+    return NV_OK;
+}
+
 static uvm_gpu_t *find_first_parent_gpu(const uvm_processor_mask_t *test_gpus,
                                         uvm_va_space_t *va_space)
 {
@@ -1416,6 +1451,7 @@ NV_STATUS uvm_test_cpu_chunk_api(UVM_TEST_CPU_CHUNK_API_PARAMS *params, struct f
 
     TEST_NV_CHECK_GOTO(test_cpu_chunk_free(va_space, test_gpus), done);
     TEST_NV_CHECK_GOTO(test_cpu_chunk_numa_alloc(va_space), done);
+    TEST_NV_CHECK_GOTO(test_cpu_chunk_pool(), done);
 
     if (uvm_processor_mask_get_gpu_count(test_gpus) >= 2) {
         uvm_gpu_t *gpu2, *gpu3 = NULL;
@@ -1447,3 +1483,25 @@ done:
     uvm_processor_mask_cache_free(test_gpus);
     return status;
 }
+
+NV_STATUS uvm_test_cpu_chunk_pool_stats(UVM_TEST_CPU_CHUNK_POOL_STATS_PARAMS *params, struct file *filp)
+{
+    uvm_cpu_chunk_pool_stats_t stats;
+
+    if (params->nid != NUMA_NO_NODE && (params->nid < 0 || params->nid >= MAX_NUMNODES))
+        return NV_ERR_INVALID_ARGUMENT;
+
+    if (!is_power_of_2(params->chunk_size) || !(params->chunk_size & uvm_cpu_chunk_get_allocation_sizes()))
+        return NV_ERR_INVALID_ARGUMENT;
+
+    if (!uvm_cpu_chunk_pool_get_stats(params->nid, params->chunk_size, &stats))
+        return NV_ERR_NOT_SUPPORTED;
+
+    params->num_pooled = stats.num_pooled;
+    params->hits = stats.hits;
+    params->direct_allocs = stats.direct_allocs;
+    params->refills = stats.refills;
+    params->shrunk = stats.shrunk;
+
+    return NV_OK;
+}
@@ -129,15 +129,14 @@ static void pte_batch_begin_inline(uvm_pte_batch_t *batch)
         uvm_pte_batch_write_consecutive_inline(batch, batch->pte_bits_queue[i]);
 }
 
-void uvm_pte_batch_write_ptes(uvm_pte_batch_t *batch, uvm_gpu_phys_address_t first_pte, NvU64 *pte_bits, NvU32 entry_size, NvU32 entry_count)
+static void pte_batch_write_ptes_inline(uvm_pte_batch_t *batch,
+                                        uvm_gpu_phys_address_t first_pte,
+                                        NvU64 *pte_bits,
+                                        NvU32 entry_size,
+                                        NvU32 entry_count)
 {
     NvU32 max_entries = UVM_PUSH_INLINE_DATA_MAX_SIZE / entry_size;
 
-    // Updating PTEs in sysmem requires a sysmembar after writing them and
-    // before any TLB invalidates.
-    if (first_pte.aperture == UVM_APERTURE_SYS)
-        batch->membar = UVM_MEMBAR_SYS;
-
     while (entry_count > 0) {
         NvU32 entries_this_time;
 
@@ -157,6 +156,69 @@ void uvm_pte_batch_write_ptes(uvm_pte_batch_t *batch, uvm_gpu_phys_address_t fir
     }
 }
 
+static void pte_batch_memset_ptes(uvm_pte_batch_t *batch,
+                                  uvm_gpu_phys_address_t first_pte,
+                                  NvU64 pte_bits,
+                                  NvU32 entry_size,
+                                  NvU32 entry_count)
+{
+    uvm_gpu_t *gpu = uvm_push_get_gpu(batch->push);
+
+    uvm_pte_batch_flush_ptes(batch);
+
+    uvm_push_set_flag(batch->push, UVM_PUSH_FLAG_CE_NEXT_PIPELINED);
+    uvm_push_set_flag(batch->push, UVM_PUSH_FLAG_NEXT_MEMBAR_NONE);
+    gpu->parent->ce_hal->memset_8(batch->push,
+                                  uvm_mmu_gpu_address(gpu, first_pte),
+                                  pte_bits,
+                                  entry_size * entry_count);
+}
+
+void uvm_pte_batch_write_ptes(uvm_pte_batch_t *batch, uvm_gpu_phys_address_t first_pte, NvU64 *pte_bits, NvU32 entry_size, NvU32 entry_count)
+{
+    NvU32 inline_start = 0;
+    NvU32 i = 0;
+
+    // Updating PTEs in sysmem requires a sysmembar after writing them and
+    // before any TLB invalidates.
+    if (first_pte.aperture == UVM_APERTURE_SYS)
+        batch->membar = UVM_MEMBAR_SYS;
+
+    // memset_8 can only replicate whole 8-byte PTEs
+    if (entry_size != sizeof(*pte_bits)) {
+        pte_batch_write_ptes_inline(batch, first_pte, pte_bits, entry_size, entry_count);
+        return;
+    }
+
+    while (i < entry_count) {
+        NvU32 run_end = i + 1;
+
+        while (run_end < entry_count && pte_bits[run_end] == pte_bits[i])
+            ++run_end;
+
+        if (run_end - i >= UVM_PTE_BATCH_MIN_MEMSET_RUN) {
+            uvm_gpu_phys_address_t run_pte = first_pte;
+
+            if (i > inline_start) {
+                run_pte.address += inline_start * entry_size;
+                pte_batch_write_ptes_inline(batch, run_pte, pte_bits + inline_start, entry_size, i - inline_start);
+                run_pte = first_pte;
+            }
+
+            run_pte.address += i * entry_size;
+            pte_batch_memset_ptes(batch, run_pte, pte_bits[i], entry_size, run_end - i);
+            inline_start = run_end;
+        }
+
+        i = run_end;
+    }
+
+    if (entry_count > inline_start) {
+        first_pte.address += inline_start * entry_size;
+        pte_batch_write_ptes_inline(batch, first_pte, pte_bits + inline_start, entry_size, entry_count - inline_start);
+    }
+}
+
 void uvm_pte_batch_write_pte(uvm_pte_batch_t *batch, uvm_gpu_phys_address_t pte, NvU64 pte_bits, NvU32 pte_size)
 {
     uvm_gpu_phys_address_t consecutive_pte_address = batch->pte_first_address;
@@ -191,19 +253,33 @@ void uvm_pte_batch_write_pte(uvm_pte_batch_t *batch, uvm_gpu_phys_address_t pte,
     uvm_pte_batch_write_consecutive(batch, pte_bits);
 }
 
-void uvm_pte_batch_clear_ptes(uvm_pte_batch_t *batch, uvm_gpu_phys_address_t first_pte, NvU64 empty_pte_bits, NvU32 entry_size, NvU32 entry_count)
+void uvm_pte_batch_write_pte_run(uvm_pte_batch_t *batch,
+                                 uvm_gpu_phys_address_t first_pte,
+                                 NvU64 pte_bits,
+                                 NvU64 pte_bits_stride,
+                                 NvU32 entry_size,
+                                 NvU32 entry_count)
 {
-    uvm_gpu_t *gpu = uvm_push_get_gpu(batch->push);
+    if (pte_bits_stride == 0 && entry_size == sizeof(pte_bits) && entry_count >= UVM_PTE_BATCH_MIN_MEMSET_RUN) {
+        pte_batch_memset_ptes(batch, first_pte, pte_bits, entry_size, entry_count);
 
-    // TODO: Bug 1767241: Allow small clears to batch
-    uvm_pte_batch_flush_ptes(batch);
+        if (first_pte.aperture == UVM_APERTURE_SYS)
+            batch->membar = UVM_MEMBAR_SYS;
 
-    uvm_push_set_flag(batch->push, UVM_PUSH_FLAG_CE_NEXT_PIPELINED);
-    uvm_push_set_flag(batch->push, UVM_PUSH_FLAG_NEXT_MEMBAR_NONE);
-    gpu->parent->ce_hal->memset_8(batch->push,
-                                  uvm_mmu_gpu_address(gpu, first_pte),
-                                  empty_pte_bits,
-                                  entry_size * entry_count);
+        return;
+    }
+
+    for (; entry_count > 0; --entry_count) {
+        uvm_pte_batch_write_pte(batch, first_pte, pte_bits, entry_size);
+        pte_bits += pte_bits_stride;
+        first_pte.address += entry_size;
+    }
+}
+
+void uvm_pte_batch_clear_ptes(uvm_pte_batch_t *batch, uvm_gpu_phys_address_t first_pte, NvU64 empty_pte_bits, NvU32 entry_size, NvU32 entry_count)
+{
+    // TODO: Bug 1767241: Allow small clears to batch
+    pte_batch_memset_ptes(batch, first_pte, empty_pte_bits, entry_size, entry_count);
 
     if (first_pte.aperture == UVM_APERTURE_SYS)
         batch->membar = UVM_MEMBAR_SYS;
@@ -42,6 +42,12 @@
 //       change as inline memcopy would have lower latency.
 #define UVM_PTE_BATCH_MAX_PTES 4
 
+// Min number of identical 8-byte PTEs for which a single CE memset is pushed
+// instead of copying the PTEs from inline data. A memset takes a fixed amount
+// of pushbuffer space regardless of how many PTEs it writes, while inline data
+// takes 8 bytes of pushbuffer per PTE and has to be written by the CPU first.
+#define UVM_PTE_BATCH_MIN_MEMSET_RUN 64
+
 struct uvm_pte_batch_struct
 {
     uvm_push_t *push;
@@ -73,6 +79,9 @@ void uvm_pte_batch_begin(uvm_push_t *push, uvm_pte_batch_t *batch);
 void uvm_pte_batch_end(uvm_pte_batch_t *batch);
 
 // Queue up a write of PTEs from a buffer
+//
+// Runs of at least UVM_PTE_BATCH_MIN_MEMSET_RUN identical 8-byte PTEs within the
+// buffer are written with a CE memset instead of being copied as inline data.
 void uvm_pte_batch_write_ptes(uvm_pte_batch_t *batch,
         uvm_gpu_phys_address_t first_pte, NvU64 *pte_bits, NvU32 entry_size, NvU32 entry_count);
 
@@ -80,6 +89,16 @@ void uvm_pte_batch_write_ptes(uvm_pte_batch_t *batch,
 void uvm_pte_batch_write_pte(uvm_pte_batch_t *batch,
         uvm_gpu_phys_address_t pte, NvU64 pte_bits, NvU32 entry_size);
 
+// Queue up a write of an arithmetic run of PTEs, where the PTE at index i is
+// pte_bits + i * pte_bits_stride.
+//
+// A constant run (pte_bits_stride of 0) of 8-byte PTEs is expanded by the GPU
+// with a single CE memset, so its pushbuffer cost doesn't depend on
+// entry_count. The CE has no memset-with-increment operation, so other runs are
+// expanded by the CPU into inline data.
+void uvm_pte_batch_write_pte_run(uvm_pte_batch_t *batch,
+        uvm_gpu_phys_address_t first_pte, NvU64 pte_bits, NvU64 pte_bits_stride, NvU32 entry_size, NvU32 entry_count);
+
 // Queue up a clear of PTEs
 void uvm_pte_batch_clear_ptes(uvm_pte_batch_t *batch,
         uvm_gpu_phys_address_t first_pte, NvU64 pte_bits, NvU32 entry_size, NvU32 entry_count);
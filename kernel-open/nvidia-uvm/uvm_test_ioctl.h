@@ -1560,6 +1560,39 @@ typedef struct
     NV_STATUS rmStatus;                     // Out
 } UVM_TEST_QUERY_ACCESS_COUNTERS_PARAMS;
 
+// Query the statistics of the pool of pre-zeroed CPU chunks of the given size
+// on the given NUMA node. NUMA_NO_NODE refers to the local memory node.
+// NV_ERR_NOT_SUPPORTED is returned if the pool is disabled, or the node has no
+// pool.
+#define UVM_TEST_CPU_CHUNK_POOL_STATS                    UVM_TEST_IOCTL_BASE(110)
+typedef struct
+{
+    NvS32 nid;                                  // In
+    NvU32 chunk_size;                           // In
+
+    NvU64 num_pooled        NV_ALIGN_BYTES(8);  // Out
+    NvU64 hits              NV_ALIGN_BYTES(8);  // Out
+    NvU64 direct_allocs     NV_ALIGN_BYTES(8);  // Out
+    NvU64 refills           NV_ALIGN_BYTES(8);  // Out
+    NvU64 shrunk            NV_ALIGN_BYTES(8);  // Out
+
+    NV_STATUS rmStatus;                         // Out
+} UVM_TEST_CPU_CHUNK_POOL_STATS_PARAMS;
+
+// Report the host memory used by the metadata of the managed VA ranges and VA
+// blocks in the VA space: the ranges' block arrays, the blocks themselves and
+// their per-NUMA node and per-GPU state. HMM blocks are not included.
+#define UVM_TEST_VA_SPACE_METADATA_USAGE                 UVM_TEST_IOCTL_BASE(111)
+typedef struct
+{
+    NvU64 num_va_blocks         NV_ALIGN_BYTES(8);  // Out
+    NvU64 num_cpu_node_states   NV_ALIGN_BYTES(8);  // Out
+    NvU64 num_gpu_states        NV_ALIGN_BYTES(8);  // Out
+    NvU64 bytes                 NV_ALIGN_BYTES(8);  // Out
+
+    NV_STATUS rmStatus;                             // Out
+} UVM_TEST_VA_SPACE_METADATA_USAGE_PARAMS;
+
 #ifdef __cplusplus
 }
 #endif
@@ -59,6 +59,10 @@ static struct kmem_cache *g_uvm_page_mask_cache __read_mostly;
 static struct kmem_cache *g_uvm_va_block_context_cache __read_mostly;
 static struct kmem_cache *g_uvm_va_block_cpu_node_state_cache __read_mostly;
 
+// Returned by block_node_state_get() for NUMA nodes on which the block has
+// never had a CPU chunk allocated. It must never be modified.
+static uvm_va_block_cpu_node_state_t g_uvm_va_block_cpu_node_state_empty;
+
 static int uvm_fault_force_sysmem __read_mostly = 0;
 module_param(uvm_fault_force_sysmem, int, S_IRUGO|S_IWUSR);
 MODULE_PARM_DESC(uvm_fault_force_sysmem, "Force (1) using sysmem storage for pages that faulted. Default: 0.");
@@ -180,10 +184,34 @@ static size_t node_to_index(int nid)
     return __nodes_weight(&node_possible_map, nid);
 }
 
+// Most blocks only ever have CPU chunks allocated on one or two NUMA nodes, so
+// the per-node state is allocated on the first chunk insertion for that node.
+// Until then, the node's entry is NULL and lookups return the shared empty
+// state, whose masks are all clear and which has no chunks. Callers which
+// modify the node state must either use block_node_state_get_alloc() or
+// otherwise know that the node has allocated pages.
+static bool block_node_state_is_allocated(uvm_va_block_t *block, int nid)
+{
+    return block->cpu.node_state[node_to_index(nid)] != NULL;
+}
+
 static uvm_va_block_cpu_node_state_t *block_node_state_get(uvm_va_block_t *block, int nid)
 {
     size_t index = node_to_index(nid);
-    UVM_ASSERT(block->cpu.node_state[index]);
+
+    if (!block->cpu.node_state[index])
+        return &g_uvm_va_block_cpu_node_state_empty;
+
+    return block->cpu.node_state[index];
+}
+
+static uvm_va_block_cpu_node_state_t *block_node_state_get_alloc(uvm_va_block_t *block, int nid)
+{
+    size_t index = node_to_index(nid);
+
+    if (!block->cpu.node_state[index])
+        block->cpu.node_state[index] = nv_kmem_cache_zalloc(g_uvm_va_block_cpu_node_state_cache, NV_UVM_GFP_FLAGS);
+
     return block->cpu.node_state[index];
 }
 
@@ -302,7 +330,7 @@ NV_STATUS uvm_cpu_chunk_insert_in_block(uvm_va_block_t *va_block, uvm_cpu_chunk_
     uvm_chunk_size_t chunk_size = uvm_cpu_chunk_get_size(chunk);
     uvm_va_block_region_t chunk_region = uvm_va_block_region(page_index, page_index + uvm_cpu_chunk_num_pages(chunk));
     int nid = uvm_cpu_chunk_get_numa_node(chunk);
-    uvm_va_block_cpu_node_state_t *node_state = block_node_state_get(va_block, nid);
+    uvm_va_block_cpu_node_state_t *node_state;
     size_t slot_index;
     uvm_cpu_chunk_storage_mixed_t *mixed;
     uvm_cpu_chunk_t **chunks = NULL;
@@ -316,6 +344,10 @@ NV_STATUS uvm_cpu_chunk_insert_in_block(uvm_va_block_t *va_block, uvm_cpu_chunk_
     // uvm_assert_mutex_locked().
     UVM_ASSERT(mutex_is_locked(&va_block->lock.m));
 
+    node_state = block_node_state_get_alloc(va_block, nid);
+    if (!node_state)
+        return NV_ERR_NO_MEMORY;
+
     if (chunk_size == UVM_CHUNK_SIZE_2M) {
         UVM_ASSERT(uvm_va_block_size(va_block) == UVM_PAGE_SIZE_2M);
         UVM_ASSERT(!node_state->chunks);
@@ -648,6 +680,10 @@ static void uvm_va_block_cpu_clear_resident_mask(uvm_va_block_t *va_block, int n
 {
     uvm_va_block_cpu_node_state_t *node_state;
 
+    // Nothing can be resident on a node which never had pages allocated.
+    if (!block_node_state_is_allocated(va_block, nid))
+        return;
+
     node_state = block_node_state_get(va_block, nid);
     UVM_ASSERT(node_state);
     uvm_page_mask_andnot(&node_state->resident, &node_state->resident, mask);
@@ -658,6 +694,9 @@ static void uvm_va_block_cpu_clear_resident_region(uvm_va_block_t *va_block, int
 {
     uvm_va_block_cpu_node_state_t *node_state;
 
+    if (!block_node_state_is_allocated(va_block, nid))
+        return;
+
     node_state = block_node_state_get(va_block, nid);
     UVM_ASSERT(node_state);
     uvm_page_mask_region_clear(&node_state->resident, region);
@@ -800,6 +839,11 @@ static bool block_check_cpu_chunks(uvm_va_block_t *block)
         }
     }
 
+    // Catch any writes to the state shared by unallocated nodes
+    UVM_ASSERT(uvm_page_mask_empty(&g_uvm_va_block_cpu_node_state_empty.allocated));
+    UVM_ASSERT(uvm_page_mask_empty(&g_uvm_va_block_cpu_node_state_empty.resident));
+    UVM_ASSERT(g_uvm_va_block_cpu_node_state_empty.chunks == 0);
+
     if (temp_resident_mask) {
         UVM_ASSERT(uvm_page_mask_equal(temp_resident_mask, &block->cpu.resident));
         kmem_cache_free(g_uvm_page_mask_cache, temp_resident_mask);
@@ -1248,7 +1292,6 @@ NV_STATUS uvm_va_block_create(uvm_va_range_managed_t *managed_range,
 {
     uvm_va_block_t *block = NULL;
     NvU64 size = end - start + 1;
-    int nid;
 
     UVM_ASSERT(PAGE_ALIGNED(start));
     UVM_ASSERT(PAGE_ALIGNED(end + 1));
@@ -1281,16 +1324,12 @@ NV_STATUS uvm_va_block_create(uvm_va_range_managed_t *managed_range,
     if (!block)
         return NV_ERR_NO_MEMORY;
 
+    // The per-node states themselves are allocated on demand. See
+    // block_node_state_get_alloc().
     block->cpu.node_state = uvm_kvmalloc_zero(sizeof(*block->cpu.node_state) * num_possible_nodes());
-    if (!block->cpu.node_state)
-        goto error_block_free;
-
-    for_each_possible_uvm_node(nid) {
-        size_t index = node_to_index(nid);
-
-        block->cpu.node_state[index] = nv_kmem_cache_zalloc(g_uvm_va_block_cpu_node_state_cache, NV_UVM_GFP_FLAGS);
-        if (!block->cpu.node_state[index])
-            goto error;
+    if (!block->cpu.node_state) {
+        uvm_va_block_free(block);
+        return NV_ERR_NO_MEMORY;
     }
 
     nv_kref_init(&block->kref);
@@ -1305,22 +1344,6 @@ NV_STATUS uvm_va_block_create(uvm_va_range_managed_t *managed_range,
 
     *out_block = block;
     return NV_OK;
-
-error:
-    if (block->cpu.node_state) {
-        for_each_possible_uvm_node(nid) {
-            size_t index = node_to_index(nid);
-
-            if (block->cpu.node_state[index])
-                kmem_cache_free(g_uvm_va_block_cpu_node_state_cache, block->cpu.node_state[index]);
-        }
-    }
-
-    uvm_kvfree(block->cpu.node_state);
-
-error_block_free:
-    uvm_va_block_free(block);
-    return NV_ERR_NO_MEMORY;
 }
 
 static void cpu_chunk_remove_sysmem_gpu_mapping(uvm_cpu_chunk_t *chunk, uvm_gpu_t *gpu)
@@ -1410,19 +1433,25 @@ error:
 // Retrieves the gpu_state for the given GPU. The returned pointer is
 // internally managed and will be allocated (and freed) automatically,
 // rather than by the caller.
+//
+// The gpu_state is mostly accessed when servicing faults from the GPU, so it's
+// allocated on the NUMA node the GPU's bottom halves run on, regardless of the
+// thread that first needed it.
 static uvm_va_block_gpu_state_t *block_gpu_state_get_alloc(uvm_va_block_t *block, uvm_gpu_t *gpu)
 {
     NV_STATUS status;
     uvm_va_block_gpu_state_t *gpu_state = uvm_va_block_gpu_state_get(block, gpu->id);
+    int numa_node = gpu->parent->closest_cpu_numa_node;
 
     if (gpu_state)
         return gpu_state;
 
-    gpu_state = nv_kmem_cache_zalloc(g_uvm_va_block_gpu_state_cache, NV_UVM_GFP_FLAGS);
+    gpu_state = nv_kmem_cache_zalloc_node(g_uvm_va_block_gpu_state_cache, NV_UVM_GFP_FLAGS, numa_node);
     if (!gpu_state)
         return NULL;
 
-    gpu_state->chunks = uvm_kvmalloc_zero(block_num_gpu_chunks(block, gpu) * sizeof(gpu_state->chunks[0]));
+    gpu_state->chunks = uvm_kvmalloc_zero_node(block_num_gpu_chunks(block, gpu) * sizeof(gpu_state->chunks[0]),
+                                               numa_node);
     if (!gpu_state->chunks)
         goto error;
 
@@ -9642,17 +9671,14 @@ static void block_kill(uvm_va_block_t *block)
         UVM_ASSERT(node_state->chunks == 0);
     }
 
-    // While a per-NUMA node_state array is in use, all of its elements are
-    // expected to be valid. Therefore the teardown of these elements must occur
-    // as a single "transaction". This teardown must take place after freeing
-    // the CPU pages (see the "Free CPU pages" loop above). This is because as
-    // part of removing chunks from VA blocks, the per-page allocated bitmap is
-    // recomputed using the per-NUMA node_state array elements.
+    // The teardown of the per-NUMA node_state array elements must take place
+    // after freeing the CPU pages (see the "Free CPU pages" loop above). This
+    // is because as part of removing chunks from VA blocks, the per-page
+    // allocated bitmap is recomputed using the per-NUMA node_state array
+    // elements.
     for_each_possible_uvm_node(nid) {
-        uvm_va_block_cpu_node_state_t *node_state;
-
-        node_state = block_node_state_get(block, nid);
-        kmem_cache_free(g_uvm_va_block_cpu_node_state_cache, node_state);
+        if (block_node_state_is_allocated(block, nid))
+            kmem_cache_free(g_uvm_va_block_cpu_node_state_cache, block_node_state_get(block, nid));
     }
     uvm_kvfree((void *)block->cpu.node_state);
     block->cpu.node_state = NULL;
@@ -10123,7 +10149,7 @@ static NV_STATUS block_prealloc_cpu_chunk_storage(uvm_va_block_t *existing, uvm_
     uvm_cpu_chunk_storage_mixed_t *existing_mixed;
     uvm_cpu_chunk_storage_mixed_t *new_mixed = NULL;
     uvm_va_block_cpu_node_state_t *node_state = block_node_state_get(existing, nid);
-    uvm_va_block_cpu_node_state_t *new_node_state = block_node_state_get(new, nid);
+    uvm_va_block_cpu_node_state_t *new_node_state = block_node_state_get_alloc(new, nid);
     size_t slot_offset;
     size_t existing_slot;
     NV_STATUS status = NV_OK;
@@ -10131,6 +10157,9 @@ static NV_STATUS block_prealloc_cpu_chunk_storage(uvm_va_block_t *existing, uvm_
     UVM_ASSERT(uvm_cpu_storage_get_type(node_state) == UVM_CPU_CHUNK_STORAGE_MIXED);
     existing_mixed = uvm_cpu_storage_get_ptr(node_state);
 
+    if (!new_node_state)
+        return NV_ERR_NO_MEMORY;
+
     // Pre-allocate chunk storage for the new block. By definition, the new
     // block will contain either 64K and/or 4K chunks.
     //
@@ -10202,6 +10231,14 @@ static NV_STATUS block_presplit_cpu_chunks(uvm_va_block_t *existing, uvm_va_bloc
     UVM_ASSERT(!IS_ALIGNED(new->start, UVM_VA_BLOCK_SIZE));
 
     for_each_possible_uvm_node(nid) {
+        if (!block_node_state_is_allocated(existing, nid))
+            continue;
+
+        // Chunks may be moved to the new block on this node, and
+        // block_split_cpu() cannot fail.
+        if (!block_node_state_get_alloc(new, nid))
+            return NV_ERR_NO_MEMORY;
+
         splitting_chunk = uvm_cpu_chunk_get_chunk_for_page(existing, nid, page_index);
 
         // If the page covering the split point has not been populated, there is
@@ -10544,8 +10581,17 @@ static void block_split_cpu(uvm_va_block_t *existing, uvm_va_block_t *new)
     // don't change.
 
     for_each_possible_uvm_node(nid) {
-        uvm_page_mask_t *existing_resident_mask = uvm_va_block_resident_mask_get(existing, UVM_ID_CPU, nid);
-        uvm_page_mask_t *new_resident_mask = uvm_va_block_resident_mask_get(new, UVM_ID_CPU, nid);
+        uvm_page_mask_t *existing_resident_mask;
+        uvm_page_mask_t *new_resident_mask;
+
+        if (!block_node_state_is_allocated(existing, nid))
+            continue;
+
+        // The new block's node state was allocated by
+        // block_presplit_cpu_chunks().
+        UVM_ASSERT(block_node_state_is_allocated(new, nid));
+        existing_resident_mask = uvm_va_block_resident_mask_get(existing, UVM_ID_CPU, nid);
+        new_resident_mask = uvm_va_block_resident_mask_get(new, UVM_ID_CPU, nid);
 
         for_each_cpu_chunk_in_block_region_safe(chunk,
                                                 page_index,
@@ -13492,6 +13538,79 @@ out:
     return status;
 }
 
+static void block_add_metadata_usage(uvm_va_block_t *block, UVM_TEST_VA_SPACE_METADATA_USAGE_PARAMS *params)
+{
+    uvm_gpu_id_t id;
+    int nid;
+
+    uvm_assert_mutex_locked(&block->lock);
+
+    params->num_va_blocks++;
+    params->bytes += sizeof(*block) + sizeof(*block->cpu.node_state) * num_possible_nodes();
+
+    for_each_possible_uvm_node(nid) {
+        uvm_va_block_cpu_node_state_t *node_state;
+
+        if (!block_node_state_is_allocated(block, nid))
+            continue;
+
+        node_state = block_node_state_get(block, nid);
+        params->num_cpu_node_states++;
+        params->bytes += sizeof(*node_state);
+
+        if (node_state->chunks && uvm_cpu_storage_get_type(node_state) == UVM_CPU_CHUNK_STORAGE_MIXED) {
+            uvm_cpu_chunk_storage_mixed_t *mixed = uvm_cpu_storage_get_ptr(node_state);
+            size_t slot_index;
+
+            params->bytes += sizeof(*mixed);
+            for_each_clear_bit(slot_index, mixed->big_chunks, MAX_BIG_CPU_CHUNK_SLOTS_PER_UVM_VA_BLOCK) {
+                if (mixed->slots[slot_index])
+                    params->bytes += sizeof(uvm_cpu_chunk_t *) * MAX_SMALL_CHUNKS_PER_BIG_SLOT;
+            }
+        }
+    }
+
+    for_each_gpu_id(id) {
+        uvm_va_block_gpu_state_t *gpu_state = uvm_va_block_gpu_state_get(block, id);
+
+        if (!gpu_state)
+            continue;
+
+        params->num_gpu_states++;
+        params->bytes += sizeof(*gpu_state) +
+                         block_num_gpu_chunks(block, uvm_gpu_get(id)) * sizeof(gpu_state->chunks[0]);
+    }
+}
+
+NV_STATUS uvm_test_va_space_metadata_usage(UVM_TEST_VA_SPACE_METADATA_USAGE_PARAMS *params, struct file *filp)
+{
+    uvm_va_space_t *va_space = uvm_va_space_get(filp);
+    uvm_va_range_managed_t *managed_range;
+    uvm_va_block_t *block;
+
+    params->num_va_blocks = 0;
+    params->num_cpu_node_states = 0;
+    params->num_gpu_states = 0;
+    params->bytes = 0;
+
+    uvm_va_space_down_read(va_space);
+
+    uvm_for_each_va_range_managed(managed_range, va_space) {
+        params->bytes += sizeof(*managed_range) +
+                         uvm_va_range_num_blocks(managed_range) * sizeof(managed_range->blocks[0]);
+
+        for_each_va_block_in_va_range(managed_range, block) {
+            uvm_mutex_lock(&block->lock);
+            block_add_metadata_usage(block, params);
+            uvm_mutex_unlock(&block->lock);
+        }
+    }
+
+    uvm_va_space_up_read(va_space);
+
+    return NV_OK;
+}
+
 NV_STATUS uvm_test_va_residency_info(UVM_TEST_VA_RESIDENCY_INFO_PARAMS *params, struct file *filp)
 {
     NV_STATUS status = NV_OK;
@@ -343,7 +343,9 @@ struct uvm_va_block_struct
     struct
     {
         // Per-NUMA node tracking of CPU allocations.
-        // This is a dense array with one entry per possible NUMA node.
+        // This is a dense array with one entry per possible NUMA node. An
+        // entry is NULL until a CPU chunk is first allocated for the block on
+        // that node, which means no pages are allocated or resident on it.
         uvm_va_block_cpu_node_state_t **node_state;
 
         // Per-page allocation bit vector.
@@ -1407,7 +1409,8 @@ static uvm_va_block_test_t *uvm_va_block_get_test(uvm_va_block_t *va_block)
 // specified by nid will be returned (see
 // uvm_va_block_cpu_node_state_t::resident). If nid is NUMA_NO_NODE,
 // the cumulative CPU residency mask will be returned (see
-// uvm_va_block_t::cpu::resident).
+// uvm_va_block_t::cpu::resident). If the block has never allocated pages on
+// nid, the returned mask is a shared empty mask which must not be modified.
 //
 // If the processor is a GPU, this will assert that GPU state is indeed present.
 uvm_page_mask_t *uvm_va_block_resident_mask_get(uvm_va_block_t *block, uvm_processor_id_t processor, int nid);
@@ -1567,6 +1570,7 @@ NV_STATUS uvm_test_va_block_inject_error(UVM_TEST_VA_BLOCK_INJECT_ERROR_PARAMS *
 NV_STATUS uvm_test_change_pte_mapping(UVM_TEST_CHANGE_PTE_MAPPING_PARAMS *params, struct file *filp);
 NV_STATUS uvm_test_va_block_info(UVM_TEST_VA_BLOCK_INFO_PARAMS *params, struct file *filp);
 NV_STATUS uvm_test_va_residency_info(UVM_TEST_VA_RESIDENCY_INFO_PARAMS *params, struct file *filp);
+NV_STATUS uvm_test_va_space_metadata_usage(UVM_TEST_VA_SPACE_METADATA_USAGE_PARAMS *params, struct file *filp);
 
 // Compute the offset in system pages of addr from the start of va_block.
 static uvm_page_index_t uvm_va_block_cpu_page_index(uvm_va_block_t *va_block, NvU64 addr)
@@ -50,6 +50,12 @@
 //
 #define DPCD_MESSAGE_REPLY_TIMEOUT              4000
 
+//
+//  The sideband MSG_SEQ_NO field is a single bit, so a branch can have at
+//  most two down requests from us awaiting a reply at any time.
+//
+#define DPCD_MESSAGE_MAX_OUTSTANDING_PER_TARGET 2
+
 #define DPCD_LINK_ADDRESS_MESSAGE_RETRIES       20  // 20 retries
 #define DPCD_LINK_ADDRESS_MESSAGE_COOLDOWN      10  // 10ms between attempts
 
@@ -197,6 +197,51 @@ namespace DisplayPort
         unsigned compoundQueryLocalLinkPBN;
         NvU64 compoundQueryUsedTunnelingBw;
         bool compoundQueryForceEnableFEC;
+
+        //
+        // Results of recent single head dpLinkIsModePossible() queries, so
+        // validating the same mode list repeatedly doesn't redo the PBN and
+        // DSC math. Entries are keyed on the query inputs plus the link
+        // configs, and are dropped by bumping compoundQueryCacheGeneration
+        // whenever link, topology or DSC state may have changed. The hit and
+        // miss counts of each generation are logged when it is dropped.
+        //
+        struct CompoundQueryCacheEntry
+        {
+            bool                bValid;
+            unsigned            generation;
+            Group *             target;
+            NvU32               groupSignature;
+            unsigned            headIndex;
+            ModesetInfo         modesetInfo;
+            DP_COLORFORMAT      colorFormat;
+            LinkConfiguration   highestAssessedLC;
+            LinkConfiguration   activeLinkConfig;
+            NvU64               allocatedDpTunnelBw;
+            bool                bDscParams;
+            bool                bErrorStatus;
+            bool                bCheckWithDsc;
+            ForceDsc            forceDsc;
+            unsigned            bitsPerPixelX16In;
+            bool                bDscOutParams;
+
+            bool                bResult;
+            DP_IMP_ERROR        errorStatus;
+            bool                bEnableDsc;
+            NvU32               sliceCountMask;
+            unsigned            bitsPerPixelX16;
+            DscOutParams        dscOutParams;
+        };
+
+        enum { compoundQueryCacheSize = 16 };
+
+        CompoundQueryCacheEntry compoundQueryCache[compoundQueryCacheSize];
+        unsigned compoundQueryCacheNext;
+        unsigned compoundQueryCacheGeneration;
+        unsigned compoundQueryCacheHits;
+        unsigned compoundQueryCacheMisses;
+        bool bCompoundQueryCacheDisabled;
+
         // WAR
         bool bDP2XPreferNonDSCForLowPClk;
 
@@ -347,6 +392,9 @@ namespace DisplayPort
 
         bool        bEnableLowerBppCheckForDsc;
 
+        // Allow several MST sideband down requests to be outstanding at once
+        bool        bParallelSidebandMsgs;
+
         //
         // Dual SST Partner connector object pointer
         ConnectorImpl *pCoupledConnector;
@@ -482,6 +530,16 @@ namespace DisplayPort
 
         virtual bool dpLinkIsModePossible(const DpLinkIsModePossibleParams &params);
 
+        void invalidateCompoundQueryCache();
+        bool compoundQueryCacheMatches(const CompoundQueryCacheEntry & entry,
+                                       const DpLinkIsModePossibleParams &params,
+                                       unsigned head);
+        bool compoundQueryCacheLookup(const DpLinkIsModePossibleParams &params,
+                                      unsigned head, bool & bResult);
+        void compoundQueryCacheInsert(const DpLinkIsModePossibleParams &params,
+                                      unsigned head, unsigned bitsPerPixelX16In,
+                                      bool bResult);
+
         virtual bool compoundQueryAttachMST(Group * target,
                                             const DpModesetParams &modesetParams,      // Modeset info
                                             DscParams *pDscParams = NULL,              // DSC parameters
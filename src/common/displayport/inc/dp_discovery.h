@@ -184,12 +184,28 @@ namespace DisplayPort
         };
 
         enum {
-            maximumTopologyNodes =  128
+            maximumTopologyNodes =  128,
+            deviceIndexSize      =  2 * maximumTopologyNodes    // power of two
         };
 
         Device  currentDevices[maximumTopologyNodes];
         unsigned currentDevicesCount;
 
+        //
+        //  Open addressed hash indices into currentDevices, keyed by
+        //  address and by GUID. Each slot holds (device index + 1), or 0
+        //  when empty. Probe chains are kept in currentDevices order so
+        //  lookups return the same device a linear scan would.
+        //
+        NvU8    addressIndex[deviceIndexSize];
+        NvU8    guidIndex[deviceIndexSize];
+
+        static unsigned hashAddress(const Address & address);
+        static unsigned hashGuid(const GUID & guid);
+        void indexDevice(unsigned deviceIndex);
+        void rebuildDeviceIndex();
+        void reportLostDevice(const Device & device);
+
         Device * findDevice(const Address & address);
         Device * findDevice(GUID & guid);
         void addDevice(const Device & device);
@@ -302,6 +318,8 @@ public:
               timer(timer),
               hal(hal)
         {
+            dpMemZero(addressIndex, sizeof(addressIndex));
+            dpMemZero(guidIndex, sizeof(guidIndex));
 
             //
             //  Register to filter all the upmessages.  We want to know when
@@ -115,6 +115,7 @@ namespace DisplayPort
         DownReplyManager    mergerDownReply;
         bool                isBeingDestroyed;
         bool                isPaused;
+        bool                bSerializeDownRequests;   // One down request in flight at a time
 
         List                messageReceivers;
         List                notYetSentDownRequest;    // Down Messages yet to be processed
@@ -125,6 +126,7 @@ namespace DisplayPort
         void onDownReplyReceived(bool status, EncodedMessage * message);
         void transmitAwaitingDownRequests();
         void transmitAwaitingUpReplies();
+        bool findFreeMessageNumber(const Address & target, unsigned & messageNumber);
 
         // IncomingTransactionManager
         void messagedReceived(IncomingTransactionManager * from, EncodedMessage * message);
@@ -139,6 +141,11 @@ namespace DisplayPort
             isPaused = true;
         }
 
+        void setDownRequestSerialization(bool bSerialize)
+        {
+            bSerializeDownRequests = bSerialize;
+        }
+
         void clearPendingMsg()
         {
             hal->clearPendingMsg();
@@ -159,7 +166,8 @@ namespace DisplayPort
             splitterUpReply(hal, timer),
             mergerUpRequest(hal, timer, Address(0), this),
             mergerDownReply(hal, timer, Address(0), this),
-            isBeingDestroyed(false), isPaused(false)
+            isBeingDestroyed(false), isPaused(false),
+            bSerializeDownRequests(true)
         {
         }
 
@@ -245,6 +253,7 @@ namespace DisplayPort
             struct {
                 unsigned         messageNumber;
                 Address          target;
+                bool             bBroadcast;    // encodedMessage is swapped out on send
             } state;
 
             virtual ParseResponseStatus parseResponseAck(
@@ -103,6 +103,13 @@
 // Bug 5041041 : Enable Lower BPP check for DSC
 #define NV_DP_REGKEY_ENABLE_LOWER_BPP_CHECK_FOR_DSC "DP_ENABLE_LOWER_BPP_CHECK"
 
+// Allow two MST sideband down requests per branch, and requests to different
+// branches, to be outstanding at the same time
+#define NV_DP_REGKEY_ENABLE_PARALLEL_SIDEBAND_MSGS  "DP_ENABLE_PARALLEL_SIDEBAND_MSGS"
+
+// Don't reuse results of earlier single head dpLinkIsModePossible() queries
+#define NV_DP_REGKEY_DISABLE_COMPOUND_QUERY_CACHE   "DP_DISABLE_COMPOUND_QUERY_CACHE"
+
 
 //
 // Data Base used to store all the regkey values.
@@ -147,6 +154,8 @@ struct DP_REGKEY_DATABASE
     bool  bEnable5147205Fix;
     bool  bForceHeadShutdown;
     bool  bEnableLowerBppCheckForDsc;
+    bool  bParallelSidebandMsgs;
+    bool  bCompoundQueryCacheDisabled;
 };
 
 extern struct DP_REGKEY_DATABASE dpRegkeyDatabase;
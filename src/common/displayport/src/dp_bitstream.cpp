@@ -56,23 +56,23 @@ bool BitStreamReader::read(unsigned * value, unsigned bits)
     }
 
     //
-    //  We're either reading too many bits or we're straddling
-    //  a byte boundary.  Serialize bit by bit.
-    //  NOTE: This scenario is entire unlikely.  Don't optimize.
+    //  We're straddling a byte boundary.  Gather the (at most five)
+    //  bytes covering the field and extract it in one go.
     //
+    DP_ASSERT(bits <= 32);
 
-    *value = 0;
-    while (bits) 
+    unsigned first = this->bitsOffset / 8;
+    unsigned count = ((this->bitsOffset & 7) + bits + 7) / 8;
+    NvU64    window = 0;
+
+    for (unsigned i = 0; i < count; i++)
     {
-        unsigned bit;
-        if (!read(&bit, 1))
-        {
-            return false;
-        }
-        *value = *value * 2 + bit;
-        bits--;
+        window = (window << 8) | this->buffer()->data[first + i];
     }
 
+    *value = (unsigned)((window >> (count * 8 - (this->bitsOffset & 7) - bits)) & ((1ULL << bits) - 1));
+
+    this->bitsOffset += bits;
     return true;
 }
 
@@ -135,15 +135,19 @@ bool BitStreamWriter::write(unsigned value, unsigned bits)
     }
 
     //
-    //  We're either writing too many bits or we're straddling
-    //  a byte boundary.  Serialize bit by bit.
-    //  NOTE: This scenario is entire unlikely.  Don't optimize.
+    //  We're straddling a byte boundary.  Fill the current byte and
+    //  then each following byte (or partial byte) in turn.
     //
-
     while (bits)
     {
-        bits --;
-        if (!write( (value >> bits) & 1, 1))
+        unsigned chunk = (7 - (this->bitsOffset & 7)) + 1;
+        if (chunk > bits)
+        {
+            chunk = bits;
+        }
+
+        bits -= chunk;
+        if (!write((value >> bits) & ((1 << chunk) - 1), chunk))
         {
             return false;
         }
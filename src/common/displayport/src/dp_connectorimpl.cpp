@@ -89,6 +89,11 @@ ConnectorImpl::ConnectorImpl(MainLink * main, AuxBus * auxBus, Timer * timer, Co
       compoundQueryActive(false),
       compoundQueryResult(false),
       compoundQueryCount(0),
+      compoundQueryCacheNext(0),
+      compoundQueryCacheGeneration(0),
+      compoundQueryCacheHits(0),
+      compoundQueryCacheMisses(0),
+      bCompoundQueryCacheDisabled(false),
       messageManager(0),
       discoveryManager(0),
       numPossibleLnkCfg(0),
@@ -112,6 +117,10 @@ ConnectorImpl::ConnectorImpl(MainLink * main, AuxBus * auxBus, Timer * timer, Co
       ResStatus(this)
 {
     clearTimeslices();
+
+    for (unsigned i = 0; i < compoundQueryCacheSize; i++)
+        compoundQueryCache[i].bValid = false;
+
     firmwareGroup = createFirmwareGroup();
 
     if (firmwareGroup == NULL)
@@ -184,6 +193,8 @@ void ConnectorImpl::applyRegkeyOverrides(const DP_REGKEY_DATABASE& dpRegkeyDatab
     this->bSkipZeroOuiCache                = dpRegkeyDatabase.bSkipZeroOuiCache;
     this->bForceHeadShutdownFromRegkey     = dpRegkeyDatabase.bForceHeadShutdown;
     this->bEnableLowerBppCheckForDsc       = dpRegkeyDatabase.bEnableLowerBppCheckForDsc;
+    this->bParallelSidebandMsgs            = dpRegkeyDatabase.bParallelSidebandMsgs;
+    this->bCompoundQueryCacheDisabled      = dpRegkeyDatabase.bCompoundQueryCacheDisabled;
     this->bDisableEffBppSST8b10b            = dpRegkeyDatabase.bDisableEffBppSST8b10b;
 }
 
@@ -891,6 +902,7 @@ ConnectorImpl::~ConnectorImpl()
 //
 void ConnectorImpl::hardwareWasReset()
 {
+    invalidateCompoundQueryCache();
     activeLinkConfig.lanes = 0;
 
     while (!activeGroups.isEmpty())
@@ -1259,11 +1271,189 @@ bool ConnectorImpl::compoundQueryAttach(Group * target,
     return compoundQueryResult;
 }
 
+void ConnectorImpl::invalidateCompoundQueryCache()
+{
+    if (compoundQueryCacheHits != 0 || compoundQueryCacheMisses != 0)
+    {
+        DP_PRINTF(DP_INFO, "DP-CONN> Compound query cache generation %u: %u hits, %u misses",
+                  compoundQueryCacheGeneration, compoundQueryCacheHits, compoundQueryCacheMisses);
+        compoundQueryCacheHits = 0;
+        compoundQueryCacheMisses = 0;
+    }
+
+    compoundQueryCacheGeneration++;
+}
+
+static NvU32 compoundQueryGroupSignature(Group * target)
+{
+    NvU32 signature = 0;
+
+    for (Device * d = target->enumDevices(0); d; d = target->enumDevices(d))
+        signature = signature * 31 + (NvU32)(NvUPtr)d;
+
+    return signature;
+}
+
+static bool compoundQueryModesetInfoMatches(const ModesetInfo & a, const ModesetInfo & b)
+{
+    return a.twoChannelAudioHz == b.twoChannelAudioHz &&
+           a.eightChannelAudioHz == b.eightChannelAudioHz &&
+           a.pixelClockHz == b.pixelClockHz &&
+           a.rasterWidth == b.rasterWidth &&
+           a.rasterHeight == b.rasterHeight &&
+           a.surfaceWidth == b.surfaceWidth &&
+           a.surfaceHeight == b.surfaceHeight &&
+           a.depth == b.depth &&
+           a.rasterBlankStartX == b.rasterBlankStartX &&
+           a.rasterBlankEndX == b.rasterBlankEndX &&
+           a.bitsPerComponent == b.bitsPerComponent &&
+           a.bEnableDsc == b.bEnableDsc &&
+           a.bEnablePassThroughForPCON == b.bEnablePassThroughForPCON &&
+           a.mode == b.mode &&
+           a.colorFormat == b.colorFormat;
+}
+
+bool ConnectorImpl::compoundQueryCacheMatches(const CompoundQueryCacheEntry & entry,
+                                              const DpLinkIsModePossibleParams &params,
+                                              unsigned head)
+{
+    const DpModesetParams * pModesetParams = params.head[head].pModesetParams;
+    const DscParams * pDscParams = params.head[head].pDscParams;
+
+    if (!entry.bValid || entry.generation != compoundQueryCacheGeneration)
+        return false;
+
+    if (entry.target != params.head[head].pTarget ||
+        entry.headIndex != pModesetParams->headIndex ||
+        entry.colorFormat != pModesetParams->colorFormat ||
+        !compoundQueryModesetInfoMatches(entry.modesetInfo, pModesetParams->modesetInfo))
+        return false;
+
+    if (entry.highestAssessedLC != highestAssessedLC ||
+        entry.activeLinkConfig != activeLinkConfig ||
+        entry.allocatedDpTunnelBw != allocatedDpTunnelBw)
+        return false;
+
+    if (entry.bDscParams != (pDscParams != NULL) ||
+        entry.bErrorStatus != (params.head[head].pErrorStatus != NULL))
+        return false;
+
+    if (pDscParams &&
+        (entry.bCheckWithDsc != pDscParams->bCheckWithDsc ||
+         entry.forceDsc != pDscParams->forceDsc ||
+         entry.bitsPerPixelX16In != pDscParams->bitsPerPixelX16 ||
+         entry.bDscOutParams != (pDscParams->pDscOutParams != NULL)))
+        return false;
+
+    return entry.groupSignature == compoundQueryGroupSignature(params.head[head].pTarget);
+}
+
+bool ConnectorImpl::compoundQueryCacheLookup(const DpLinkIsModePossibleParams &params,
+                                             unsigned head, bool & bResult)
+{
+    for (unsigned i = 0; i < compoundQueryCacheSize; i++)
+    {
+        const CompoundQueryCacheEntry & entry = compoundQueryCache[i];
+
+        if (!compoundQueryCacheMatches(entry, params, head))
+            continue;
+
+        if (params.head[head].pErrorStatus != NULL)
+            *params.head[head].pErrorStatus = entry.errorStatus;
+
+        if (params.head[head].pDscParams != NULL)
+        {
+            DscParams * pDscParams = params.head[head].pDscParams;
+
+            pDscParams->bEnableDsc = entry.bEnableDsc;
+            pDscParams->sliceCountMask = entry.sliceCountMask;
+            pDscParams->bitsPerPixelX16 = entry.bitsPerPixelX16;
+            if (pDscParams->pDscOutParams != NULL)
+                *pDscParams->pDscOutParams = entry.dscOutParams;
+        }
+
+        compoundQueryCacheHits++;
+        bResult = entry.bResult;
+        return true;
+    }
+
+    compoundQueryCacheMisses++;
+    return false;
+}
+
+void ConnectorImpl::compoundQueryCacheInsert(const DpLinkIsModePossibleParams &params,
+                                             unsigned head, unsigned bitsPerPixelX16In,
+                                             bool bResult)
+{
+    CompoundQueryCacheEntry & entry = compoundQueryCache[compoundQueryCacheNext];
+    const DpModesetParams * pModesetParams = params.head[head].pModesetParams;
+    const DscParams * pDscParams = params.head[head].pDscParams;
+
+    compoundQueryCacheNext = (compoundQueryCacheNext + 1) % compoundQueryCacheSize;
+
+    entry.bValid = true;
+    entry.generation = compoundQueryCacheGeneration;
+    entry.target = params.head[head].pTarget;
+    entry.groupSignature = compoundQueryGroupSignature(entry.target);
+    entry.headIndex = pModesetParams->headIndex;
+    entry.modesetInfo = pModesetParams->modesetInfo;
+    entry.colorFormat = pModesetParams->colorFormat;
+    entry.highestAssessedLC = highestAssessedLC;
+    entry.activeLinkConfig = activeLinkConfig;
+    entry.allocatedDpTunnelBw = allocatedDpTunnelBw;
+    entry.bDscParams = (pDscParams != NULL);
+    entry.bErrorStatus = (params.head[head].pErrorStatus != NULL);
+
+    entry.bResult = bResult;
+    entry.errorStatus = (params.head[head].pErrorStatus != NULL) ?
+                        *params.head[head].pErrorStatus : DP_IMP_ERROR_NONE;
+
+    if (pDscParams != NULL)
+    {
+        entry.bCheckWithDsc = pDscParams->bCheckWithDsc;
+        entry.forceDsc = pDscParams->forceDsc;
+        entry.bitsPerPixelX16In = bitsPerPixelX16In;
+        entry.bDscOutParams = (pDscParams->pDscOutParams != NULL);
+        entry.bEnableDsc = pDscParams->bEnableDsc;
+        entry.sliceCountMask = pDscParams->sliceCountMask;
+        entry.bitsPerPixelX16 = pDscParams->bitsPerPixelX16;
+        if (pDscParams->pDscOutParams != NULL)
+            entry.dscOutParams = *pDscParams->pDscOutParams;
+    }
+}
+
 bool ConnectorImpl::dpLinkIsModePossible(const DpLinkIsModePossibleParams &params)
 {
     bool bResult;
     NvU32 numNonDscStreams;
     bool bEnableFEC = false;
+    unsigned cacheHead = NV_MAX_HEADS;
+    unsigned bitsPerPixelX16In = 0;
+
+    //
+    // Only single head queries without forced DSC parameters are cached;
+    // a guessed link would be assessed by beginCompoundQuery() first.
+    //
+    if (!bCompoundQueryCacheDisabled && !linkGuessed)
+    {
+        for (NvU32 i = 0; i < NV_MAX_HEADS; i++)
+        {
+            if (params.head[i].pTarget == NULL)
+                continue;
+
+            if (cacheHead != NV_MAX_HEADS ||
+                (params.head[i].pDscParams != NULL &&
+                 params.head[i].pDscParams->forcedParams != NULL))
+            {
+                cacheHead = NV_MAX_HEADS;
+                break;
+            }
+            cacheHead = i;
+        }
+    }
+
+    if ((cacheHead != NV_MAX_HEADS) && (params.head[cacheHead].pDscParams != NULL))
+        bitsPerPixelX16In = params.head[cacheHead].pDscParams->bitsPerPixelX16;
 
 reRunCompoundQuery:
     bResult = true;
@@ -1280,6 +1470,18 @@ reRunCompoundQuery:
 
     this->beginCompoundQuery(bEnableFEC /* bForceEnableFEC */);
 
+    //
+    // Look the query up only after beginCompoundQuery() has reset the
+    // compound query state, so a hit leaves that state as a query that
+    // attached nothing would.
+    //
+    if ((cacheHead != NV_MAX_HEADS) && !bEnableFEC &&
+        compoundQueryCacheLookup(params, cacheHead, bResult))
+    {
+        this->endCompoundQuery();
+        return bResult;
+    }
+
     for (NvU32 i = 0; i < NV_MAX_HEADS; i++)
     {
         if (params.head[i].pTarget == NULL)
@@ -1320,6 +1522,11 @@ reRunCompoundQuery:
     if (!this->endCompoundQuery())
         bResult = false;
 
+    if (cacheHead != NV_MAX_HEADS)
+    {
+        compoundQueryCacheInsert(params, cacheHead, bitsPerPixelX16In, bResult);
+    }
+
     return bResult;
 }
 
@@ -2413,6 +2620,7 @@ void ConnectorImpl::expired(const void * tag)
 //      context, or this context.
 void ConnectorImpl::fireEvents()
 {
+    invalidateCompoundQueryCache();
     bool eventsPending = false;
 
     // Don't fire any events if we're not done with the modeset
@@ -3061,6 +3269,8 @@ bool ConnectorImpl::notifyAttachBegin(Group * target,               // Group of
 
 bool ConnectorImpl::setDeviceDscState(Device * dev, bool bEnableDsc)
 {
+    invalidateCompoundQueryCache();
+
     if (!((DeviceImpl *)dev)->isDSCPossible())
     {
         return true;
@@ -3483,6 +3693,7 @@ bool ConnectorImpl::notifyAttachBegin(Group *                target,       // Gr
 //
 void ConnectorImpl::notifyAttachEnd(bool modesetCancelled)
 {
+    invalidateCompoundQueryCache();
     GroupImpl* currentModesetDeviceGroup = NULL;
     DP_PRINTF(DP_NOTICE, "DPCONN> Notify Attach End");
     NV_DPTRACE_INFO(NOTIFY_ATTACH_END);
@@ -3622,6 +3833,7 @@ void ConnectorImpl::notifyDetachBegin(Group * target)
 //
 void ConnectorImpl::notifyDetachEnd(bool bKeepOdAlive)
 {
+    invalidateCompoundQueryCache();
     GroupImpl* currentModesetDeviceGroup = NULL;
     DP_PRINTF(DP_NOTICE, "DPCONN> Notify detach end");
     NV_DPTRACE_INFO(NOTIFY_DETACH_END);
@@ -4272,6 +4484,7 @@ bool ConnectorImpl::allocateMaxDpTunnelBw()
 
 void ConnectorImpl::assessLink(LinkTrainingType trainType)
 {
+    invalidateCompoundQueryCache();
     this->bSkipLt = false;  // Assesslink should never skip LT, so let's reset it in case it was set.
     bool  bLinkStateToggle = false;
     NvU32 retryCount = 0;
@@ -5655,6 +5868,8 @@ bool ConnectorImpl::validateLinkConfiguration(const LinkConfiguration & lConfig)
 bool ConnectorImpl::train(const LinkConfiguration & lConfig, bool force,
                           LinkTrainingType trainType)
 {
+    invalidateCompoundQueryCache();
+
     LinkTrainingType preferredTrainingType = trainType;
     bool result = true;
 
@@ -6572,6 +6787,7 @@ void ConnectorImpl::disconnectDeviceList()
 // status == true: attach, == false: detach
 void ConnectorImpl::notifyLongPulse(bool statusConnected)
 {
+    invalidateCompoundQueryCache();
     NvU32 muxState = 0;
     NV_DPTRACE_INFO(HOTPLUG, statusConnected, connectorActive, previousPlugged);
 
@@ -6865,6 +7081,7 @@ void ConnectorImpl::notifyLongPulseInternal(bool statusConnected)
             //   that may be in the pipe.
             //
             messageManager = new MessageManager(hal, timer);
+            messageManager->setDownRequestSerialization(!bParallelSidebandMsgs);
             messageManager->registerReceiver(&ResStatus);
 
             //
@@ -7174,6 +7391,8 @@ void ConnectorImpl::handleDpTunnelingIrq()
 
 void ConnectorImpl::notifyShortPulse()
 {
+    invalidateCompoundQueryCache();
+
     //
     // Do nothing if device is not plugged or
     // resume has not been called after hibernate
@@ -7503,6 +7722,9 @@ bool ConnectorImpl::setPreferredLinkConfig(LinkConfiguration & lc, bool commit,
     // need to force assessLink and during NotifyAttachBegin
     this->forcePreferredLinkConfig = forcePreferredLinkConfig;
 
+    // The preferred link configuration caps the mode-possible math
+    invalidateCompoundQueryCache();
+
     if (force)
     {
         // Do flushmode
@@ -7528,6 +7750,7 @@ bool ConnectorImpl::resetPreferredLinkConfig(bool force)
 {
     preferredLinkConfig = LinkConfiguration();
     this->forcePreferredLinkConfig = false;
+    invalidateCompoundQueryCache();
 
     if (force)
         assessLink();
@@ -80,9 +80,56 @@ void DiscoveryManager::detectSink(DiscoveryManager::Device device, bool bFromCSN
     sinkDetection->start();
 }
 
-DiscoveryManager::Device * DiscoveryManager::findDevice(const Address & address)
+unsigned DiscoveryManager::hashAddress(const Address & address)
+{
+    unsigned hash = address.size();
+
+    for (unsigned i = 0; i < address.size(); i++)
+        hash = hash * 31 + address[i];
+
+    return hash & (deviceIndexSize - 1);
+}
+
+unsigned DiscoveryManager::hashGuid(const GUID & guid)
+{
+    unsigned hash = 0;
+
+    for (unsigned i = 0; i < DPCD_GUID_SIZE; i++)
+        hash = hash * 31 + guid.data[i];
+
+    return hash & (deviceIndexSize - 1);
+}
+
+void DiscoveryManager::indexDevice(unsigned deviceIndex)
+{
+    unsigned slot;
+
+    slot = hashAddress(currentDevices[deviceIndex].address);
+    while (addressIndex[slot])
+        slot = (slot + 1) & (deviceIndexSize - 1);
+    addressIndex[slot] = (NvU8)(deviceIndex + 1);
+
+    slot = hashGuid(currentDevices[deviceIndex].peerGuid);
+    while (guidIndex[slot])
+        slot = (slot + 1) & (deviceIndexSize - 1);
+    guidIndex[slot] = (NvU8)(deviceIndex + 1);
+}
+
+void DiscoveryManager::rebuildDeviceIndex()
 {
+    dpMemZero(addressIndex, sizeof(addressIndex));
+    dpMemZero(guidIndex, sizeof(guidIndex));
+
     for (unsigned i = 0; i < currentDevicesCount; i++)
+        indexDevice(i);
+}
+
+DiscoveryManager::Device * DiscoveryManager::findDevice(const Address & address)
+{
+    for (unsigned slot = hashAddress(address); addressIndex[slot]; slot = (slot + 1) & (deviceIndexSize - 1))
+    {
+        unsigned i = addressIndex[slot] - 1;
+
         if (currentDevices[i].address == address)
         {
             if (currentDevices[i].peerGuid.isGuidZero() && currentDevices[i].peerDevice != Dongle &&
@@ -92,6 +139,7 @@ DiscoveryManager::Device * DiscoveryManager::findDevice(const Address & address)
             }
             return &currentDevices[i];
         }
+    }
 
     return 0;
 }
@@ -104,8 +152,10 @@ DiscoveryManager::Device * DiscoveryManager::findDevice(GUID & guid)
         return 0;
     }
 
-    for (unsigned i = 0; i < currentDevicesCount; i++)
+    for (unsigned slot = hashGuid(guid); guidIndex[slot]; slot = (slot + 1) & (deviceIndexSize - 1))
     {
+        unsigned i = guidIndex[slot] - 1;
+
         if (currentDevices[i].dpcdRevisionMajor <= 1 && currentDevices[i].dpcdRevisionMinor < 2)
             continue;
 
@@ -144,34 +194,62 @@ void DiscoveryManager::addDevice(const DiscoveryManager::Device & device)
 
     if (currentDevicesCount < maximumTopologyNodes)
     {
-        currentDevices[currentDevicesCount++] = device;
+        currentDevices[currentDevicesCount] = device;
+        indexDevice(currentDevicesCount++);
     }
 }
 
-void DiscoveryManager::removeDevice(Device * device)
+void DiscoveryManager::reportLostDevice(const Device & device)
 {
     Address::StringBuffer sb;
     DP_USED(sb);
 
-    DP_PRINTF(DP_NOTICE, "DP-DM> Lost device '%s' %s %s %s", device->address.toString(sb),
-              device->branch ? "Branch" : "", device->legacy ? "Legacy" : "",
-              device->peerDevice == Dongle ? "Dongle" :
-              device->peerDevice == DownstreamSink ? "DownstreamSink" : "");
+    DP_PRINTF(DP_NOTICE, "DP-DM> Lost device '%s' %s %s %s", device.address.toString(sb),
+              device.branch ? "Branch" : "", device.legacy ? "Legacy" : "",
+              device.peerDevice == Dongle ? "Dongle" :
+              device.peerDevice == DownstreamSink ? "DownstreamSink" : "");
+
+    sink->discoveryLostDevice(device.address);
+}
 
-    sink->discoveryLostDevice(device->address);
+void DiscoveryManager::removeDevice(Device * device)
+{
+    reportLostDevice(*device);
 
     for (unsigned i = (unsigned)(device-&currentDevices[0]); i < currentDevicesCount - 1; i++)
         currentDevices[i] = currentDevices[i+1];
     currentDevicesCount--;
+
+    rebuildDeviceIndex();
 }
 
+//
+//  Report every device under the prefix first, then compact the table
+//  and rebuild the indices once rather than once per removed device.
+//
 void DiscoveryManager::removeDeviceTree(const Address & prefix)
 {
-    for (unsigned i = 0; i < currentDevicesCount;)
+    unsigned kept = 0;
+
+    for (unsigned i = 0; i < currentDevicesCount; i++)
         if (currentDevices[i].address.under(prefix))
-            removeDevice(&currentDevices[i]);
-        else
-            i++;
+            reportLostDevice(currentDevices[i]);
+
+    for (unsigned i = 0; i < currentDevicesCount; i++)
+    {
+        if (currentDevices[i].address.under(prefix))
+            continue;
+
+        if (kept != i)
+            currentDevices[kept] = currentDevices[i];
+        kept++;
+    }
+
+    if (kept != currentDevicesCount)
+    {
+        currentDevicesCount = kept;
+        rebuildDeviceIndex();
+    }
 }
 
 DiscoveryManager::Device * DiscoveryManager::findChildDeviceForBranchWithGuid
@@ -217,7 +217,13 @@ void  MessageManager::Message::expired(const void * tag)
     if (parent && !parent->isBeingDestroyed)
     {
         parent->awaitingReplyDownRequest.remove(this);
-        parent->clearPendingMsg();
+
+        //
+        // Only drop a pending reply when nothing else is outstanding;
+        // it may belong to another request still awaiting its reply.
+        //
+        if (parent->awaitingReplyDownRequest.isEmpty())
+            parent->clearPendingMsg();
         parent->transmitAwaitingDownRequests();
         parent->transmitAwaitingUpReplies();
     }
@@ -226,9 +232,44 @@ void  MessageManager::Message::expired(const void * tag)
         sink->messageFailed(this, &nakData);
 }
 
+//
+//  Pick a sideband message number for a down request that is not already
+//  in use by another request awaiting a reply from the same target.
+//
+bool MessageManager::findFreeMessageNumber(const Address & target, unsigned & messageNumber)
+{
+    unsigned usedMask = 0;
+
+    for (ListElement * i = awaitingReplyDownRequest.begin(); i!=awaitingReplyDownRequest.end(); i=i->next)
+    {
+        Message * m = (Message *)i;
+
+        if (m->state.target == target)
+            usedMask |= 1 << m->state.messageNumber;
+    }
+
+    for (unsigned n = 0; n < DPCD_MESSAGE_MAX_OUTSTANDING_PER_TARGET; n++)
+    {
+        if (!(usedMask & (1 << n)))
+        {
+            messageNumber = n;
+            return true;
+        }
+    }
+
+    return false;
+}
+
 //
 //  Enqueue the next message to the splitterDownRequest
 //
+//  Unless serialized (the default), up to two requests may await a reply
+//  from any one target since branches match replies by (target, message
+//  number) and the message number is a single bit. Requests are sent in
+//  queue order: the first request that cannot be sent blocks the ones
+//  behind it. Broadcast requests are always sent exclusively since their
+//  replies can come back from any branch.
+//
 void MessageManager::transmitAwaitingDownRequests()
 {
     for (ListElement * i = notYetSentDownRequest.begin(); i!=notYetSentDownRequest.end(); )
@@ -236,25 +277,43 @@ void MessageManager::transmitAwaitingDownRequests()
         Message * m = (Message *)i;
         i = i->next;                    // Do this first since we may unlink the current node
 
-        if (awaitingReplyDownRequest.isEmpty())
+        if (!awaitingReplyDownRequest.isEmpty())
         {
             //
-            //    Set the message number, and unlink from the outgoing queue
+            //  A broadcast (or serialized) request waits for the pipe to
+            //  drain; don't let lower priority requests overtake it.
             //
-            m->encodedMessage.messageNumber = 0;
-            m->state.messageNumber = 0;
-
-            notYetSentDownRequest.remove(m);
-            awaitingReplyDownRequest.insertBack(m);
+            if (bSerializeDownRequests || m->state.bBroadcast)
+                return;
 
-            //
-            //  This call can cause transmitAwaitingDownRequests to be called again
-            //
-            bool sent = splitterDownRequest.send(m->encodedMessage, m);
-            DP_ASSERT(sent);
+            if (((Message *)awaitingReplyDownRequest.begin())->state.bBroadcast)
+                return;
+        }
 
+        //
+        //  The target already has two requests awaiting a reply. Don't let
+        //  requests queued behind this one overtake it.
+        //
+        unsigned messageNumber;
+        if (!findFreeMessageNumber(m->state.target, messageNumber))
             return;
-        }
+
+        //
+        //    Set the message number, and unlink from the outgoing queue
+        //
+        m->encodedMessage.messageNumber = messageNumber;
+        m->state.messageNumber = messageNumber;
+
+        notYetSentDownRequest.remove(m);
+        awaitingReplyDownRequest.insertBack(m);
+
+        //
+        //  This call can cause transmitAwaitingDownRequests to be called again
+        //
+        bool sent = splitterDownRequest.send(m->encodedMessage, m);
+        DP_ASSERT(sent);
+
+        return;
     }
 }
 
@@ -348,6 +407,7 @@ void MessageManager::post(Message * message, Message::MessageEventSink * sink, b
 
     message->parent = this;
     message->transmitReply = transmitReply;
+    message->state.bBroadcast = message->encodedMessage.isBroadcast;
     if (message->encodedMessage.isBroadcast)
     {
         // if its a broadcast message; the target would be the immediate branch.
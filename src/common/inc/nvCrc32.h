@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __NV_CRC32_H__
+#define __NV_CRC32_H__
+
+#include "nvtypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * CRC32 using the reflected IEEE-802.3 polynomial (0xEDB88320), as used by
+ * xz, zlib and the EDID CRC.
+ *
+ * 'crc' is the value returned by a previous call, or 0 to start a new
+ * checksum; the pre- and post-inversion are applied internally, so a buffer
+ * may be checksummed in pieces:
+ *
+ *   crc = nvCrc32(0, pBuf, 10);
+ *   crc = nvCrc32(crc, pBuf + 10, size - 10);
+ *
+ * The implementation is a table-driven slice-by-8 loop and does not use any
+ * FPU or SIMD state, so it is safe to call from any kernel context.
+ */
+NvU32 nvCrc32(NvU32 crc, const void *pBuf, NvLength size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NV_CRC32_H__ */
@@ -259,6 +259,9 @@ struct nvlink_link
     NvU32 seedData[NVLINK_MAX_SEED_BUFFER_SIZE];
 
     struct nvlink_link_error_threshold errorThreshold;
+
+    // Time spent in each phase of the most recent training attempt
+    nvlink_link_training_times trainingTimes;
 };
 
 // nvlink link handler ops
@@ -1122,6 +1122,70 @@ typedef struct
     NvU64                  time;
 } nvlink_get_device_link_states;
 
+/*
+ * Link training phases whose duration is tracked per link. Each entry is the
+ * time spent waiting for the link to complete that phase during its most
+ * recent training attempt.
+ */
+#define NVLINK_TRAINING_PHASE_SAFE          0   /* OFF -> SAFE(SWCFG) */
+#define NVLINK_TRAINING_PHASE_SUBLINK_HS    1   /* Sublinks to HS (pre-NVLink 3.0) */
+#define NVLINK_TRAINING_PHASE_HS            2   /* SAFE(SWCFG) -> ACTIVE */
+#define NVLINK_TRAINING_PHASE_COUNT         3
+
+typedef struct
+{
+    NV_DECLARE_ALIGNED(NvU64 phaseTimeNs[NVLINK_TRAINING_PHASE_COUNT], 8);
+    NvBool bTimeout[NVLINK_TRAINING_PHASE_COUNT];
+} nvlink_link_training_times;
+
+/*
+ * CTRL_NVLINK_GET_DEVICE_LINK_TRAINING_TIMES
+ *
+ * Returns the per-phase training times of all links on a given device.
+ *
+ * Parameters:
+ *   devInfo [IN]
+ *      nvlink device identification information.
+ *
+ *   status [OUT]
+ *      One of the NVL_XXX status value.
+ *
+ *   linkTimes [OUT]
+ *      Per-phase training times, indexed by link number. Phases a link has
+ *      not been through, and links that are not registered, read as zero.
+ */
+typedef struct
+{
+    /* input parameters */
+    nvlink_device_info         devInfo;
+
+    /* output parameters */
+    NvlStatus                  status;
+    nvlink_link_training_times linkTimes[NVLINK_MAX_DEVICE_CONN];
+} nvlink_get_device_link_training_times;
+
+/*
+ * CTRL_NVLINK_SET_TRAINING_CONCURRENCY
+ *
+ * Bounds the number of intranode connections that are trained to ACTIVE
+ * together. Larger requests are trained in consecutive batches of this size.
+ *
+ * Parameters:
+ *   maxConns [IN]
+ *      Maximum connections trained together. 0 removes the bound.
+ *
+ *   status [OUT]
+ *      One of the NVL_XXX status value.
+ */
+typedef struct
+{
+    /* input parameters */
+    NvU32     maxConns;
+
+    /* output parameters */
+    NvlStatus status;
+} nvlink_set_training_concurrency;
+
 /* 
  * Note: Verify that new parameter structs for IOCTLs satisfy 
  *       sizing restrictions for all OSs they could be used in.
@@ -1170,6 +1234,8 @@ typedef struct
 #define CTRL_NVLINK_RESERVED_9                               0x29
 #define CTRL_NVLINK_RESERVED_10                              0x2A
 #define CTRL_NVLINK_RESERVED_11                              0x2B
+#define CTRL_NVLINK_GET_DEVICE_LINK_TRAINING_TIMES           0x2C
+#define CTRL_NVLINK_SET_TRAINING_CONCURRENCY                 0x2D
 /* Do not add code after this line */
 
 #endif // _NVLINK_LIB_CTRL_H_
@@ -29,6 +29,7 @@
 
 static NvBool _nvlink_core_all_links_initialized(void);
 static void   _nvlink_core_discover_topology(void);
+static void   _nvlink_core_discover_topology_linear(void);
 
 /**
  * Get the remote end of the link
@@ -124,13 +125,112 @@ nvlink_core_discover_and_get_remote_end
     }
 }
 
+//
+// Per-link discovery state.  Each registered link is visited once: its link
+// mode is sampled and, if it needs one, its AN0 token is sent.  Peers are then
+// matched through the hash tables below instead of re-scanning every link for
+// every endpoint.
+//
+#define NVLINK_DISCOVERY_SKIP            0x0   // RX detect failed or already connected
+#define NVLINK_DISCOVERY_NOT_CONNECTED   0x1   // Cannot take part in discovery
+#define NVLINK_DISCOVERY_SID             0x2   // Peer known from the SIDs reported by Minion
+#define NVLINK_DISCOVERY_TOKEN           0x3   // Peer found by reading back the AN0 token
+
+typedef struct
+{
+    nvlink_link *link;
+    NvU32        method;     // NVLINK_DISCOVERY_*
+} nvlink_discovery_link;
+
+//
+// Open-addressed table from (key, subkey) to the first link inserted with
+// that pair, so lookups resolve to the same peer the registration-order
+// scan would have found first.
+//
+typedef struct
+{
+    NvU64        key;
+    NvU32        subkey;
+    nvlink_link *link;
+} nvlink_discovery_bucket;
+
+typedef struct
+{
+    NvU32                    mask;
+    nvlink_discovery_bucket *buckets;
+} nvlink_discovery_table;
+
+static NvU32
+_nvlink_discovery_hash
+(
+    nvlink_discovery_table *table,
+    NvU64                   key,
+    NvU32                   subkey
+)
+{
+    key ^= (NvU64)subkey * 0xC2B2AE3D27D4EB4FULL;
+    key *= 0x9E3779B97F4A7C15ULL;
+
+    return (NvU32)(key >> 32) & table->mask;
+}
+
+static void
+_nvlink_discovery_insert
+(
+    nvlink_discovery_table *table,
+    NvU64                   key,
+    NvU32                   subkey,
+    nvlink_link            *link
+)
+{
+    NvU32 idx = _nvlink_discovery_hash(table, key, subkey);
+
+    while (table->buckets[idx].link != NULL)
+    {
+        // Keep the first link registered with this key
+        if ((table->buckets[idx].key == key) && (table->buckets[idx].subkey == subkey))
+        {
+            return;
+        }
+        idx = (idx + 1) & table->mask;
+    }
+
+    table->buckets[idx].key    = key;
+    table->buckets[idx].subkey = subkey;
+    table->buckets[idx].link   = link;
+}
+
+static nvlink_link *
+_nvlink_discovery_lookup
+(
+    nvlink_discovery_table *table,
+    NvU64                   key,
+    NvU32                   subkey
+)
+{
+    NvU32 idx = _nvlink_discovery_hash(table, key, subkey);
+
+    while (table->buckets[idx].link != NULL)
+    {
+        if ((table->buckets[idx].key == key) && (table->buckets[idx].subkey == subkey))
+        {
+            return table->buckets[idx].link;
+        }
+        idx = (idx + 1) & table->mask;
+    }
+
+    return NULL;
+}
+
 /**
- * Discovery process to determine topology
+ * Discovery process to determine topology, without the hash tables
  *
- *    Involves sending and reading back AN0 packets/SID values
+ *    Involves sending and reading back AN0 packets/SID values. Every
+ *    endpoint scans all the registered links for its peer, so this is only
+ *    used when the discovery state cannot be allocated.
  */
 static void
-_nvlink_core_discover_topology(void)
+_nvlink_core_discover_topology_linear(void)
 {
     nvlink_device         *dev0         = NULL;
     nvlink_device         *dev1         = NULL;
@@ -266,6 +366,228 @@ _nvlink_core_discover_topology(void)
     }
 }
 
+/**
+ * Discovery process to determine topology
+ *
+ *    Involves sending and reading back AN0 packets/SID values
+ *
+ *    Every link is visited a constant number of times: once to send its
+ *    token, once to read back the token it received, and once to be matched
+ *    against its peer through a hash lookup.
+ */
+static void
+_nvlink_core_discover_topology(void)
+{
+    nvlink_device          *dev         = NULL;
+    nvlink_link            *end0        = NULL;
+    nvlink_link            *end1        = NULL;
+    nvlink_intranode_conn  *conn        = NULL;
+    nvlink_discovery_link  *links       = NULL;
+    nvlink_discovery_table  sidTable;
+    nvlink_discovery_table  tokenTable;
+    NvU64                   linkMode    = NVLINK_LINKSTATE_OFF;
+    NvU64                   token       = 0;
+    NvU32                   linkCount   = 0;
+    NvU32                   tableSize   = 1;
+    NvU32                   numTokens   = 0;
+    NvU32                   i;
+
+    nvlinkLibCtx.notConnectedEndpoints = 0;
+
+    FOR_EACH_DEVICE_REGISTERED(dev, nvlinkLibCtx.nv_devicelist_head, node)
+    {
+        FOR_EACH_LINK_REGISTERED(end0, dev, node)
+        {
+            linkCount++;
+        }
+    }
+
+    if (linkCount == 0)
+    {
+        return;
+    }
+
+    while (tableSize < 2 * linkCount)
+    {
+        tableSize <<= 1;
+    }
+
+    links = (nvlink_discovery_link *)nvlink_malloc(
+                sizeof(nvlink_discovery_link) * linkCount +
+                sizeof(nvlink_discovery_bucket) * tableSize * 2);
+    if (links == NULL)
+    {
+        NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+            "%s: Failed to allocate discovery state for %d links, "
+            "falling back to a linear scan\n",
+            __FUNCTION__, linkCount));
+
+        _nvlink_core_discover_topology_linear();
+        return;
+    }
+
+    sidTable.mask      = tableSize - 1;
+    sidTable.buckets   = (nvlink_discovery_bucket *)(links + linkCount);
+    tokenTable.mask    = tableSize - 1;
+    tokenTable.buckets = sidTable.buckets + tableSize;
+    nvlink_memset(sidTable.buckets, 0, sizeof(nvlink_discovery_bucket) * tableSize * 2);
+
+    //
+    // Pass 1: classify each link and send the AN0 packet where needed. Links
+    // reporting a local SID are indexed by (SID, link number) so that SID
+    // peers can be found without touching hardware again.
+    //
+    linkCount = 0;
+    FOR_EACH_DEVICE_REGISTERED(dev, nvlinkLibCtx.nv_devicelist_head, node)
+    {
+        FOR_EACH_LINK_REGISTERED(end0, dev, node)
+        {
+            nvlink_discovery_link *pLink = &links[linkCount++];
+
+            pLink->link   = end0;
+            pLink->method = NVLINK_DISCOVERY_SKIP;
+
+            //
+            // If receiver detect failed for the link or if clocks could not be set
+            // up for the link, then move to next link
+            //
+            if (!end0->bRxDetected || end0->bTxCommonModeFail)
+                continue;
+
+            if (end0->localSid != 0)
+            {
+                _nvlink_discovery_insert(&sidTable, end0->localSid, end0->linkNumber, end0);
+            }
+
+            conn = NULL;
+            nvlink_core_get_intranode_conn(end0, &conn);
+            if (conn != NULL)
+            {
+                continue;
+            }
+
+            if (end0->packet_injection_retries > NVLINK_MAX_NUM_PACKET_INJECTION_RETRIES)
+            {
+                NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_INFO,
+                    "%s: Packet injection retries reached for %s:%s.\n",
+                    __FUNCTION__, end0->dev->deviceName, end0->linkName));
+                pLink->method = NVLINK_DISCOVERY_NOT_CONNECTED;
+                continue;
+            }
+
+            end0->link_handlers->get_dl_link_mode(end0, &linkMode);
+
+            // Packet injection can only happen on links that are in SAFE or ACTIVE
+            if (!((linkMode == NVLINK_LINKSTATE_SAFE) || (linkMode == NVLINK_LINKSTATE_HS)))
+            {
+                NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_INFO,
+                    "%s: Packet injection only works for links in SAFE or HS %s:%s.\n",
+                    __FUNCTION__, end0->dev->deviceName, end0->linkName));
+                pLink->method = NVLINK_DISCOVERY_NOT_CONNECTED;
+                continue;
+            }
+
+            //
+            // Send the AN0 packet
+            // For Nvlink3.0, token mechanism is handled by Minion.
+            // SW gets Sids values and so write_disocvery_token is Stubbed for Nvlink 3.0
+            // We use the return value of write_discovery_token to shift between 
+            // Nvlink2.0 and NvLink3.0
+            //
+            if ((end0->version < NVLINK_DEVICE_VERSION_30) ||
+                ((end0->localSid == 0) || (end0->remoteSid == 0)))
+            {
+                end0->link_handlers->write_discovery_token(end0, end0->token);
+                pLink->method = NVLINK_DISCOVERY_TOKEN;
+                numTokens++;
+            }
+            else
+            {
+                pLink->method = NVLINK_DISCOVERY_SID;
+            }
+            end0->packet_injection_retries++;
+        }
+    }
+
+    //
+    // Pass 2: with every token in flight, read back the token each link
+    // received exactly once and index the links by it.
+    //
+    if (numTokens != 0)
+    {
+        for (i = 0; i < linkCount; i++)
+        {
+            end1 = links[i].link;
+
+            if (!end1->bRxDetected || end1->bTxCommonModeFail)
+                continue;
+
+            token = 0;
+            end1->link_handlers->read_discovery_token(end1, (NvU64 *) &token);
+            if (token != 0)
+            {
+                _nvlink_discovery_insert(&tokenTable, token, 0, end1);
+            }
+        }
+    }
+
+    // Pass 3: match each endpoint with its peer
+    for (i = 0; i < linkCount; i++)
+    {
+        end0 = links[i].link;
+
+        if (links[i].method == NVLINK_DISCOVERY_SKIP)
+            continue;
+
+        // The link may have been matched as the peer of an earlier endpoint
+        conn = NULL;
+        nvlink_core_get_intranode_conn(end0, &conn);
+        if (conn != NULL)
+        {
+            continue;
+        }
+
+        if (links[i].method == NVLINK_DISCOVERY_NOT_CONNECTED)
+        {
+            nvlinkLibCtx.notConnectedEndpoints++;
+            continue;
+        }
+
+        if (links[i].method == NVLINK_DISCOVERY_SID)
+        {
+            end1 = _nvlink_discovery_lookup(&sidTable, end0->remoteSid, end0->remoteLinkId);
+        }
+        else
+        {
+            end1 = _nvlink_discovery_lookup(&tokenTable, end0->token, 0);
+
+            //
+            // If R4 tokens were used for NVLink3.0+, then mark initnegotiate
+            // passed, since ALT training won't get kicked off without it.
+            //
+            if ((end1 != NULL) && (end0->version >= NVLINK_DEVICE_VERSION_30))
+            {
+                end0->bInitnegotiateConfigGood = NV_TRUE;
+                end1->bInitnegotiateConfigGood = NV_TRUE;
+            }
+        }
+
+        // If the peer was found, establish the connection
+        if (end1 != NULL)
+        {
+            nvlink_core_add_intranode_conn(end0, end1);
+        }
+
+        if (nvlinkLibCtx.connectedEndpoints ==
+           (nvlinkLibCtx.registeredEndpoints - nvlinkLibCtx.notConnectedEndpoints))
+        {
+            break;
+        }
+    }
+
+    nvlink_free((void *)links);
+}
+
 /**
  * Are all links trained or is there a need to re-attempt training ?
  *
@@ -27,6 +27,8 @@
 #include "../nvlink_ctx.h"
 #include "../nvlink_helper.h"
 
+static void _nvlink_core_wait_for_links_safe(nvlink_link **, NvU32);
+
 /**
  * Initialize all the endpoints from OFF to SWCFG state
  *
@@ -264,17 +266,7 @@ nvlink_core_init_links_from_off_to_swcfg
     }
 
     // Poll for links to enter SAFE mode
-    for (i = 0; i < numLinks; i++)
-    {
-        if (pLinks[i] == NULL)
-            continue;
-
-        status = nvlink_core_wait_for_link_init(pLinks[i]);
-        if (status == NVL_SUCCESS)
-        {
-            pLinks[i]->powerStateTransitionStatus = nvlink_power_state_in_L0;
-        }
-    }
+    _nvlink_core_wait_for_links_safe(pLinks, numLinks);
 
     // Send INITNEGOTIATE to all the links
     nvlink_core_initnegotiate(pLinks, numLinks, flags);
@@ -485,17 +477,7 @@ nvlink_core_init_links_from_off_to_swcfg_non_ALI
     }
 
     // Poll for links to enter SAFE mode
-    for (i = 0; i < numLinks; i++)
-    {
-        if (pLinks[i] == NULL)
-            continue;
-
-        status = nvlink_core_wait_for_link_init(pLinks[i]);
-        if (status == NVL_SUCCESS)
-        {
-            pLinks[i]->powerStateTransitionStatus = nvlink_power_state_in_L0;
-        }
-    }
+    _nvlink_core_wait_for_links_safe(pLinks, numLinks);
 
     // Send INITNEGOTIATE to all the links
     nvlink_core_initnegotiate(pLinks, numLinks, flags);
@@ -1712,14 +1694,15 @@ nvlink_core_initnegotiate
 }
 
 /**
- * Poll on SAFE/SWCFG on the given link
+ * Check whether the given link is still training towards SAFE/SWCFG
  *
  * @param[in]  link  nvlink_link pointer
  *
- * return NvlStatus
+ * return NVL_MORE_PROCESSING_REQUIRED if the link needs to be polled,
+ *        otherwise the final init status of the link
  */
-NvlStatus
-nvlink_core_wait_for_link_init
+static NvlStatus
+_nvlink_core_link_init_precheck
 (
     nvlink_link *link
 )
@@ -1783,40 +1766,227 @@ nvlink_core_wait_for_link_init
 
     // reset state since we're trying again
     link->bSafeTransitionFail = NV_FALSE;
+    nvlink_core_clear_training_times(link, NVLINK_TRAINING_PHASE_SAFE);
+
+    return NVL_MORE_PROCESSING_REQUIRED;
+}
+
+/**
+ * Poll the given links together for SAFE/SWCFG. Links that fail to reach
+ * SAFE are marked with bSafeTransitionFail.
+ *
+ * @param[in]  links       Array of links that passed the init precheck.
+ *                         The array is reordered by this call
+ * @param[in]  numLinks    Number of links in the array
+ * @param[in]  pollStatus  Scratch array of numLinks entries
+ */
+static void
+_nvlink_core_poll_links_init
+(
+    nvlink_link **links,
+    NvU32         numLinks,
+    NvlStatus    *pollStatus
+)
+{
+    NvU32 numSafe = 0;
+    NvU32 i;
 
     // poll for link state
-    status = nvlink_core_poll_link_state(link,
-                                         NVLINK_LINKSTATE_SAFE,
-                                         NVLINK_TRANSITION_SAFE_TIMEOUT);
-    if (status != NVL_SUCCESS)
+    nvlink_core_poll_links_state(links, numLinks,
+                                 NVLINK_LINKSTATE_SAFE,
+                                 NVLINK_TRANSITION_SAFE_TIMEOUT,
+                                 NVLINK_TRAINING_PHASE_SAFE,
+                                 pollStatus);
+
+    for (i = 0; i < numLinks; i++)
     {
-        NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
-            "%s: Unable to put link in SAFE %s:%s\n",
-            __FUNCTION__, link->dev->deviceName, link->linkName));
+        if (pollStatus[i] != NVL_SUCCESS)
+        {
+            NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+                "%s: Unable to put link in SAFE %s:%s\n",
+                __FUNCTION__, links[i]->dev->deviceName, links[i]->linkName));
 
-        link->bSafeTransitionFail = NV_TRUE;
-        return status;
+            links[i]->bSafeTransitionFail = NV_TRUE;
+            continue;
+        }
+
+        links[numSafe++] = links[i];
     }
 
     // poll sublink state as well.
-    status = nvlink_core_poll_sublink_state(link,
-                                            NVLINK_SUBLINK_STATE_TX_SAFE,
-                                            NVLINK_SUBLINK_SUBSTATE_TX_STABLE,
-                                            link,
-                                            NVLINK_SUBLINK_STATE_RX_SAFE,
-                                            NVLINK_SUBLINK_SUBSTATE_RX_STABLE,
-                                            NVLINK_TRANSITION_SAFE_TIMEOUT);
-    if (status != NVL_SUCCESS)
+    nvlink_core_poll_links_sublink_state(links,
+                                         NVLINK_SUBLINK_STATE_TX_SAFE,
+                                         NVLINK_SUBLINK_SUBSTATE_TX_STABLE,
+                                         links,
+                                         NVLINK_SUBLINK_STATE_RX_SAFE,
+                                         NVLINK_SUBLINK_SUBSTATE_RX_STABLE,
+                                         numSafe,
+                                         NVLINK_TRANSITION_SAFE_TIMEOUT,
+                                         NVLINK_TRAINING_PHASE_NONE,
+                                         pollStatus);
+
+    for (i = 0; i < numSafe; i++)
     {
-        NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
-            "%s: Unable to put sublink in SAFE %s:%s\n",
-             __FUNCTION__, link->dev->deviceName, link->linkName));
+        if (pollStatus[i] != NVL_SUCCESS)
+        {
+            NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+                "%s: Unable to put sublink in SAFE %s:%s\n",
+                 __FUNCTION__, links[i]->dev->deviceName, links[i]->linkName));
 
-        link->bSafeTransitionFail = NV_TRUE;
+            links[i]->bSafeTransitionFail = NV_TRUE;
+        }
+    }
+}
+
+/**
+ * Poll on SAFE/SWCFG on the given link
+ *
+ * @param[in]  link  nvlink_link pointer
+ *
+ * return NvlStatus
+ */
+NvlStatus
+nvlink_core_wait_for_link_init
+(
+    nvlink_link *link
+)
+{
+    NvlStatus status = _nvlink_core_link_init_precheck(link);
+
+    if (status != NVL_MORE_PROCESSING_REQUIRED)
+    {
         return status;
     }
 
+    _nvlink_core_poll_links_init(&link, 1, &status);
+
     // link is in SAFE state, initialization is success.
+    return link->bSafeTransitionFail ? NVL_ERR_INVALID_STATE : NVL_SUCCESS;
+}
+
+/**
+ * Poll on SAFE/SWCFG on the given array of links. All the links that are
+ * still training are polled together, so a link that fails to reach SAFE
+ * does not hold up the rest.
+ *
+ * @param[in]   links       Array of nvlink_link pointers
+ * @param[in]   numLinks    Number of links in the array
+ * @param[out]  linkStatus  Per-link init status, as returned by
+ *                          nvlink_core_wait_for_link_init
+ *
+ * return NVL_SUCCESS if the links were polled
+ */
+NvlStatus
+nvlink_core_wait_for_links_init
+(
+    nvlink_link **links,
+    NvU32         numLinks,
+    NvlStatus    *linkStatus
+)
+{
+    nvlink_link **pendingLinks = NULL;
+    NvlStatus    *pollStatus   = NULL;
+    NvU32         numPending   = 0;
+    NvU32         i;
+
+    if ((links == NULL) || (linkStatus == NULL))
+    {
+        return NVL_BAD_ARGS;
+    }
+
+    pendingLinks = (nvlink_link **)nvlink_malloc(
+                        (sizeof(nvlink_link *) + sizeof(NvlStatus)) * numLinks);
+    if (pendingLinks == NULL)
+    {
+        // Fall back to polling the links one at a time
+        for (i = 0; i < numLinks; i++)
+        {
+            linkStatus[i] = (links[i] != NULL) ?
+                            nvlink_core_wait_for_link_init(links[i]) : NVL_BAD_ARGS;
+        }
+
+        return NVL_SUCCESS;
+    }
+
+    pollStatus = (NvlStatus *)(pendingLinks + numLinks);
+
+    for (i = 0; i < numLinks; i++)
+    {
+        if (links[i] == NULL)
+        {
+            linkStatus[i] = NVL_BAD_ARGS;
+            continue;
+        }
+
+        linkStatus[i] = _nvlink_core_link_init_precheck(links[i]);
+        if (linkStatus[i] == NVL_MORE_PROCESSING_REQUIRED)
+        {
+            pendingLinks[numPending++] = links[i];
+        }
+    }
+
+    _nvlink_core_poll_links_init(pendingLinks, numPending, pollStatus);
+
+    for (i = 0; i < numLinks; i++)
+    {
+        if (linkStatus[i] == NVL_MORE_PROCESSING_REQUIRED)
+        {
+            linkStatus[i] = links[i]->bSafeTransitionFail ?
+                            NVL_ERR_INVALID_STATE : NVL_SUCCESS;
+        }
+    }
+
+    nvlink_free((void *)pendingLinks);
+
     return NVL_SUCCESS;
 }
 
+/**
+ * Poll the given links for SAFE/SWCFG and mark the ones that reached it as
+ * being in L0
+ *
+ * @param[in]  links     Array of nvlink_link pointers
+ * @param[in]  numLinks  Number of links in the array
+ */
+static void
+_nvlink_core_wait_for_links_safe
+(
+    nvlink_link **links,
+    NvU32         numLinks
+)
+{
+    NvlStatus *linkStatus = NULL;
+    NvlStatus  status;
+    NvU32      i;
+
+    linkStatus = (NvlStatus *)nvlink_malloc(sizeof(NvlStatus) * numLinks);
+    if (linkStatus != NULL)
+    {
+        nvlink_core_wait_for_links_init(links, numLinks, linkStatus);
+    }
+
+    for (i = 0; i < numLinks; i++)
+    {
+        if (links[i] == NULL)
+            continue;
+
+        if (linkStatus != NULL)
+        {
+            status = linkStatus[i];
+        }
+        else
+        {
+            status = nvlink_core_wait_for_link_init(links[i]);
+        }
+
+        if (status == NVL_SUCCESS)
+        {
+            links[i]->powerStateTransitionStatus = nvlink_power_state_in_L0;
+        }
+    }
+
+    if (linkStatus != NULL)
+    {
+        nvlink_free((void *)linkStatus);
+    }
+}
@@ -537,3 +537,286 @@ nvlink_core_poll_rx_sublink_state
 
     return NVL_SUCCESS;
 }
+
+/**
+ * Record how long a link took in the given training phase
+ *
+ * @param[in]  link       NVLink pointer
+ * @param[in]  phase      One of NVLINK_TRAINING_PHASE_*, or _NONE to skip
+ * @param[in]  startTime  Platform time at which polling began
+ * @param[in]  bTimeout   Whether the link failed to complete the phase
+ */
+static void
+_nvlink_core_record_training_time
+(
+    nvlink_link *link,
+    NvU32        phase,
+    NvU64        startTime,
+    NvBool       bTimeout
+)
+{
+    if (phase == NVLINK_TRAINING_PHASE_NONE)
+        return;
+
+    link->trainingTimes.phaseTimeNs[phase] = nvlink_get_platform_time() - startTime;
+    link->trainingTimes.bTimeout[phase]    = bTimeout;
+}
+
+/**
+ * Clear the training times a link recorded for the given phase and every
+ * phase after it, so a new attempt does not report a previous one's times
+ *
+ * @param[in]  link        NVLink pointer
+ * @param[in]  firstPhase  First NVLINK_TRAINING_PHASE_* to clear
+ */
+void
+nvlink_core_clear_training_times
+(
+    nvlink_link *link,
+    NvU32        firstPhase
+)
+{
+    NvU32 phase;
+
+    for (phase = firstPhase; phase < NVLINK_TRAINING_PHASE_COUNT; phase++)
+    {
+        link->trainingTimes.phaseTimeNs[phase] = 0;
+        link->trainingTimes.bTimeout[phase]    = NV_FALSE;
+    }
+}
+
+/**
+ * Poll a set of links together for each to reach the specified state. All
+ * the links share one timeout, so the total wait is bounded by the slowest
+ * link rather than the sum of every link's wait.
+ *
+ * @param[in]   links       Array of NVLink pointers. NULL entries are skipped
+ * @param[in]   numLinks    Number of links in the array
+ * @param[in]   linkState   Target link state
+ * @param[in]   timeout     Timeout
+ * @param[in]   phase       Training phase the time is recorded against
+ * @param[out]  linkStatus  Per-link result, NVL_SUCCESS if the link
+ *                          transitioned to the target state
+ *
+ * return NVL_SUCCESS if all the links transitioned to the target state
+ */
+NvlStatus
+nvlink_core_poll_links_state
+(
+    nvlink_link **links,
+    NvU32         numLinks,
+    NvU64         linkState,
+    NvU32         timeout,
+    NvU32         phase,
+    NvlStatus    *linkStatus
+)
+{
+    NvU64     startTime        = nvlink_get_platform_time();
+    NvU64     currentLinkState = ~0;
+    NvU32     numPending       = 0;
+    NvlStatus status           = NVL_SUCCESS;
+    NvU32     i;
+
+    if ((links == NULL) || (linkStatus == NULL))
+    {
+        return NVL_BAD_ARGS;
+    }
+
+    for (i = 0; i < numLinks; i++)
+    {
+        linkStatus[i] = NVL_SUCCESS;
+
+        if (links[i] == NULL)
+            continue;
+
+        if (links[i]->version >= NVLINK_DEVICE_VERSION_50)
+        {
+            if ((linkState == NVLINK_LINKSTATE_RESET) ||
+                (linkState == NVLINK_LINKSTATE_SAFE))
+            {
+                continue;
+            }
+        }
+
+        linkStatus[i] = NVL_MORE_PROCESSING_REQUIRED;
+        numPending++;
+    }
+
+    while (numPending != 0)
+    {
+        for (i = 0; i < numLinks; i++)
+        {
+            if (linkStatus[i] != NVL_MORE_PROCESSING_REQUIRED)
+                continue;
+
+            links[i]->link_handlers->get_dl_link_mode(links[i], &currentLinkState);
+            if (currentLinkState == linkState)
+            {
+                _nvlink_core_record_training_time(links[i], phase, startTime, NV_FALSE);
+                linkStatus[i] = NVL_SUCCESS;
+                numPending--;
+            }
+            else if (timeout == 0)
+            {
+                NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+                    "%s: Timeout occured while polling on link.\n",
+                    __FUNCTION__));
+
+                NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+                    "%s: Link info: device: %s link: %s link state "
+                    "expected: 0x%08llx actual: 0x%08llx.\n",
+                    __FUNCTION__, links[i]->dev->deviceName, links[i]->linkName,
+                    linkState, currentLinkState));
+
+                _nvlink_core_record_training_time(links[i], phase, startTime, NV_TRUE);
+                linkStatus[i] = NVL_ERR_INVALID_STATE;
+                status = NVL_ERR_INVALID_STATE;
+                numPending--;
+            }
+        }
+
+        if (numPending == 0)
+            break;
+
+        nvlink_sleep(1);
+
+        // The final sweep after the timeout expires fails any remaining links
+        if (timeout > 0)
+        {
+            timeout--;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * Poll a set of tx/rx sublink pairs together for each pair to reach the
+ * specified states. All the pairs share one timeout.
+ *
+ * @param[in]   txLinks            Array of local NVLink pointers
+ * @param[in]   txSublinkState     Tx Sublink State
+ * @param[in]   txSublinkSubState  Tx Sublink Substate
+ * @param[in]   rxLinks            Array of remote NVLink pointers, parallel
+ *                                 to txLinks
+ * @param[in]   rxSublinkState     Rx Sublink State
+ * @param[in]   rxSublinkSubState  Rx Sublink Substate
+ * @param[in]   numLinks           Number of entries in the arrays
+ * @param[in]   timeout            Timeout
+ * @param[in]   phase              Training phase the time is recorded against
+ * @param[out]  linkStatus         Per-pair result, NVL_SUCCESS if both sublinks
+ *                                 transitioned to the target states
+ *
+ * return NVL_SUCCESS if all the sublinks transitioned to the target states
+ */
+NvlStatus
+nvlink_core_poll_links_sublink_state
+(
+    nvlink_link **txLinks,
+    NvU64         txSublinkState,
+    NvU32         txSublinkSubState,
+    nvlink_link **rxLinks,
+    NvU64         rxSublinkState,
+    NvU32         rxSublinkSubState,
+    NvU32         numLinks,
+    NvU32         timeout,
+    NvU32         phase,
+    NvlStatus    *linkStatus
+)
+{
+    NvU64     startTime       = nvlink_get_platform_time();
+    NvU64     currentState    = ~0;
+    NvU32     currentSubState = ~0;
+    NvU32     numPending      = 0;
+    NvlStatus status          = NVL_SUCCESS;
+    NvBool    bTxDone;
+    NvU32     i;
+
+    if ((txLinks == NULL) || (rxLinks == NULL) || (linkStatus == NULL))
+    {
+        return NVL_BAD_ARGS;
+    }
+
+    for (i = 0; i < numLinks; i++)
+    {
+        linkStatus[i] = NVL_SUCCESS;
+
+        if ((txLinks[i] == NULL) || (rxLinks[i] == NULL))
+        {
+            linkStatus[i] = NVL_BAD_ARGS;
+            status = NVL_BAD_ARGS;
+            continue;
+        }
+
+        if (txLinks[i]->version >= NVLINK_DEVICE_VERSION_50)
+            continue;
+
+        linkStatus[i] = NVL_MORE_PROCESSING_REQUIRED;
+        numPending++;
+    }
+
+    while (numPending != 0)
+    {
+        for (i = 0; i < numLinks; i++)
+        {
+            if (linkStatus[i] != NVL_MORE_PROCESSING_REQUIRED)
+                continue;
+
+            txLinks[i]->link_handlers->get_tx_mode(txLinks[i],
+                                                   &currentState,
+                                                   &currentSubState);
+            bTxDone = ((currentState == txSublinkState) &&
+                       (currentSubState == txSublinkSubState));
+
+            if (bTxDone)
+            {
+                rxLinks[i]->link_handlers->get_rx_mode(rxLinks[i],
+                                                       &currentState,
+                                                       &currentSubState);
+                if ((currentState == rxSublinkState) &&
+                    (currentSubState == rxSublinkSubState))
+                {
+                    _nvlink_core_record_training_time(txLinks[i], phase, startTime, NV_FALSE);
+                    linkStatus[i] = NVL_SUCCESS;
+                    numPending--;
+                    continue;
+                }
+            }
+
+            if (timeout == 0)
+            {
+                NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+                    "%s: Timeout occured while polling on link.\n",
+                    __FUNCTION__));
+
+                NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+                    "%s: Link info: device: %s link: %s %ssublink state "
+                    "expected: 0x%08llx actual: 0x%08llx.\n",
+                    __FUNCTION__,
+                    bTxDone ? rxLinks[i]->dev->deviceName : txLinks[i]->dev->deviceName,
+                    bTxDone ? rxLinks[i]->linkName : txLinks[i]->linkName,
+                    bTxDone ? "rx" : "tx",
+                    bTxDone ? rxSublinkState : txSublinkState,
+                    currentState));
+
+                _nvlink_core_record_training_time(txLinks[i], phase, startTime, NV_TRUE);
+                linkStatus[i] = NVL_ERR_INVALID_STATE;
+                status = NVL_ERR_INVALID_STATE;
+                numPending--;
+            }
+        }
+
+        if (numPending == 0)
+            break;
+
+        nvlink_sleep(1);
+
+        // The final sweep after the timeout expires fails any remaining links
+        if (timeout > 0)
+        {
+            timeout--;
+        }
+    }
+
+    return status;
+}
@@ -31,6 +31,138 @@ static void _nvlink_core_set_sublink_pre_hs_settings(nvlink_link *, NvU32);
 static void _nvlink_core_set_link_pre_active_settings(nvlink_link *, NvU32);
 static void _nvlink_core_set_link_post_active_settings(nvlink_link *, NvU32);
 
+// Most links any training sequence polls per connection
+#define NVLINK_MAX_POLL_LINKS_PER_CONN  3
+
+/**
+ * Allocate the scratch arrays used to poll a set of links together
+ *
+ * @param[in]   numLinks        Number of links to be polled
+ * @param[in]   connLinks       Caller storage of NVLINK_MAX_POLL_LINKS_PER_CONN
+ *                              entries, used when numLinks fits in it
+ * @param[in]   connLinkStatus  Caller storage matching connLinks
+ * @param[out]  pLinks          Array of numLinks link pointers, zeroed
+ * @param[out]  pLinkStatus     Array of numLinks poll results
+ *
+ * return NVL_SUCCESS if the arrays were allocated
+ */
+static NvlStatus
+_nvlink_core_alloc_poll_links
+(
+    NvU32          numLinks,
+    nvlink_link  **connLinks,
+    NvlStatus     *connLinkStatus,
+    nvlink_link ***pLinks,
+    NvlStatus    **pLinkStatus
+)
+{
+    NvU32 size = (sizeof(nvlink_link *) + sizeof(NvlStatus)) * numLinks;
+
+    // A single connection never needs to allocate
+    if (numLinks <= NVLINK_MAX_POLL_LINKS_PER_CONN)
+    {
+        nvlink_memset(connLinks, 0, sizeof(nvlink_link *) * numLinks);
+        *pLinks      = connLinks;
+        *pLinkStatus = connLinkStatus;
+
+        return NVL_SUCCESS;
+    }
+
+    *pLinks = (nvlink_link **)nvlink_malloc(size);
+    if (*pLinks == NULL)
+    {
+        NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+            "%s: Failed to allocate polling state for %d links\n",
+            __FUNCTION__, numLinks));
+
+        return NVL_NO_MEM;
+    }
+
+    nvlink_memset(*pLinks, 0, size);
+    *pLinkStatus = (NvlStatus *)(*pLinks + numLinks);
+
+    return NVL_SUCCESS;
+}
+
+/**
+ * Free the scratch arrays returned by _nvlink_core_alloc_poll_links
+ *
+ * @param[in]  links      Link array returned by _nvlink_core_alloc_poll_links
+ * @param[in]  connLinks  Caller storage passed to _nvlink_core_alloc_poll_links
+ */
+static void
+_nvlink_core_free_poll_links
+(
+    nvlink_link **links,
+    nvlink_link **connLinks
+)
+{
+    if ((links != NULL) && (links != connLinks))
+    {
+        nvlink_free((void *)links);
+    }
+}
+
+/**
+ * Train intranode connections in batches of at most batchSize connections.
+ * Each call starts a new training attempt, so the times recorded by the
+ * previous attempt are cleared first.
+ *
+ * @param[in]  conns      Array of connections to train
+ * @param[in]  connCount  Number of connections in the array
+ * @param[in]  flags      Flags to track if training is sync/async
+ * @param[in]  batchSize  Connections per batch, 0 to train them all together
+ * @param[in]  trainFn    Training sequence to run on each batch
+ *
+ * return NVL_SUCCESS if all the batches train successfully
+ */
+static NvlStatus
+_nvlink_core_train_intranode_conns_batched
+(
+    nvlink_intranode_conn **conns,
+    NvU32                   connCount,
+    NvU32                   flags,
+    NvU32                   batchSize,
+    NvlStatus             (*trainFn)(nvlink_intranode_conn **, NvU32, NvU32)
+)
+{
+    NvlStatus status      = NVL_SUCCESS;
+    NvlStatus batchStatus = NVL_SUCCESS;
+    NvU32     i;
+
+    if (conns == NULL)
+    {
+        return trainFn(conns, connCount, flags);
+    }
+
+    for (i = 0; i < connCount; i++)
+    {
+        if (conns[i] == NULL)
+            continue;
+
+        nvlink_core_clear_training_times(conns[i]->end0, NVLINK_TRAINING_PHASE_SUBLINK_HS);
+        nvlink_core_clear_training_times(conns[i]->end1, NVLINK_TRAINING_PHASE_SUBLINK_HS);
+    }
+
+    if ((batchSize == 0) || (batchSize >= connCount))
+    {
+        return trainFn(conns, connCount, flags);
+    }
+
+    for (i = 0; i < connCount; i += batchSize)
+    {
+        batchStatus = trainFn(&conns[i],
+                              ((connCount - i) < batchSize) ? (connCount - i) : batchSize,
+                              flags);
+        if (batchStatus != NVL_SUCCESS)
+        {
+            status = batchStatus;
+        }
+    }
+
+    return status;
+}
+
 NvlStatus
 nvlink_core_train_check_link_ready_ALI
 (
@@ -88,9 +220,13 @@ nvlink_core_train_internode_conns_from_swcfg_to_active
     NvU32                   flags
 )
 {
-    NvlStatus status     = NVL_SUCCESS;
-    NvU32     i;
-    NvBool    skipConn[NVLINK_MAX_SYSTEM_LINK_NUM] = {0};
+    NvlStatus     status     = NVL_SUCCESS;
+    nvlink_link **pollLinks  = NULL;
+    NvlStatus    *pollStatus = NULL;
+    nvlink_link  *connLinks[NVLINK_MAX_POLL_LINKS_PER_CONN];
+    NvlStatus     connLinkStatus[NVLINK_MAX_POLL_LINKS_PER_CONN];
+    NvU32         i;
+    NvBool        skipConn[NVLINK_MAX_SYSTEM_LINK_NUM] = {0};
 
     if ((conns == NULL) || (connCount == 0) || (isMasterEnd == 0))
     {
@@ -101,11 +237,25 @@ nvlink_core_train_internode_conns_from_swcfg_to_active
         return NVL_BAD_ARGS;
     }
 
+    //
+    // Without the scratch arrays the links are polled one at a time below.
+    // The training itself does not depend on them, so FM still gets success.
+    //
+    if (_nvlink_core_alloc_poll_links(connCount, connLinks, connLinkStatus,
+                                      &pollLinks, &pollStatus) != NVL_SUCCESS)
+    {
+        pollLinks = NULL;
+    }
+
     for (i = 0; i < connCount; i++)
     {
         if (conns[i] == NULL)
             continue;
 
+        // A new attempt starts, drop the times recorded by the previous one
+        nvlink_core_clear_training_times(conns[i]->local_end,
+                                         NVLINK_TRAINING_PHASE_SUBLINK_HS);
+
         // Don't do anything if the link is already at HS.
         if ((nvlink_core_check_link_state(conns[i]->local_end, NVLINK_LINKSTATE_HS)) &&
             (nvlink_core_check_tx_sublink_state(conns[i]->local_end,
@@ -166,15 +316,40 @@ nvlink_core_train_internode_conns_from_swcfg_to_active
         }
     }
 
+    if (pollLinks != NULL)
+    {
+        for (i = 0; i < connCount; i++)
+        {
+            pollLinks[i] = (conns[i] != NULL) ? conns[i]->local_end : NULL;
+        }
+
+        // Wait for the link state to change on all the links together
+        nvlink_core_poll_links_state(pollLinks, connCount,
+                                     NVLINK_LINKSTATE_HS,
+                                     NVLINK_TRANSITION_HS_TIMEOUT,
+                                     NVLINK_TRAINING_PHASE_HS,
+                                     pollStatus);
+    }
+
     for (i = 0; i < connCount; i++)
     {
         if (conns[i] == NULL)
             continue;
 
-        // Wait for the link state to change.
-        status = nvlink_core_poll_link_state(conns[i]->local_end,
-                                             NVLINK_LINKSTATE_HS,
-                                             NVLINK_TRANSITION_HS_TIMEOUT);
+        if (pollLinks != NULL)
+        {
+            status = pollStatus[i];
+        }
+        else
+        {
+            // Wait for the link state to change.
+            nvlink_core_poll_links_state(&conns[i]->local_end, 1,
+                                         NVLINK_LINKSTATE_HS,
+                                         NVLINK_TRANSITION_HS_TIMEOUT,
+                                         NVLINK_TRAINING_PHASE_HS,
+                                         &status);
+        }
+
         if (status != NVL_SUCCESS)
         {
             NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
@@ -196,6 +371,8 @@ nvlink_core_train_internode_conns_from_swcfg_to_active
         _nvlink_core_set_link_post_active_settings(conns[i]->local_end, flags);
     }
 
+    _nvlink_core_free_poll_links(pollLinks, connLinks);
+
     //
     // Always return success to FM on training failures
     // FM will read link states to determine sucessfull training
@@ -777,26 +954,23 @@ nvlink_core_train_intranode_conns_from_from_L2_to_active
 }
 
 /**
- * Train intranode connections associated with a list of links to HS
- * using non-ALI sequence
- *
- * @param[in]  conns      Array of connections to train
- * @param[in]  connCount  Number of connections in the array
- * @param[in]  flags      Flags to track if training is sync/async
- *
- * return NVL_SUCCESS if the connections train successfully
+ * Train one batch of intranode connections to HS using the non-ALI sequence.
+ * See nvlink_core_train_intranode_conns_from_swcfg_to_active_non_ALI
  */
-NvlStatus
-nvlink_core_train_intranode_conns_from_swcfg_to_active_non_ALI
+static NvlStatus
+_nvlink_core_train_intranode_conns_from_swcfg_to_active_non_ALI
 (
     nvlink_intranode_conn **conns,
     NvU32                   connCount,
     NvU32                   flags
 )
 {
-    NvlStatus status     = NVL_SUCCESS;
-    NvlStatus pollStatus = NVL_SUCCESS;
-    NvU32     i;
+    NvlStatus     status     = NVL_SUCCESS;
+    nvlink_link **pollLinks  = NULL;
+    NvlStatus    *pollStatus = NULL;
+    nvlink_link  *connLinks[NVLINK_MAX_POLL_LINKS_PER_CONN];
+    NvlStatus     connLinkStatus[NVLINK_MAX_POLL_LINKS_PER_CONN];
+    NvU32         i;
 
     if ((conns == NULL) || (connCount == 0))
     {
@@ -807,6 +981,16 @@ nvlink_core_train_intranode_conns_from_swcfg_to_active_non_ALI
         return NVL_ERR_GENERIC;
     }
 
+    // Both ends of each connection are polled
+    status = _nvlink_core_alloc_poll_links(connCount * 2, connLinks, connLinkStatus,
+                                           &pollLinks, &pollStatus);
+    if (status != NVL_SUCCESS)
+    {
+        // Fall back to training and polling one connection at a time
+        return _nvlink_core_train_intranode_conns_batched(conns, connCount, flags, 1,
+                   _nvlink_core_train_intranode_conns_from_swcfg_to_active_non_ALI);
+    }
+
     // Trigger INITOPTIMIZE on both ends of the connection
     for (i = 0; i < connCount; i++)
     {
@@ -876,21 +1060,20 @@ nvlink_core_train_intranode_conns_from_swcfg_to_active_non_ALI
         if (conns[i] == NULL)
             continue;
 
-        pollStatus = nvlink_core_poll_link_state(conns[i]->end0,
-                                                NVLINK_LINKSTATE_HS,
-                                                NVLINK_TRANSITION_HS_TIMEOUT);
-        if (pollStatus != NVL_SUCCESS)
-        {
-            status = pollStatus;
-        }
+        pollLinks[i]             = conns[i]->end0;
+        pollLinks[connCount + i] = conns[i]->end1;
+    }
 
-        pollStatus = nvlink_core_poll_link_state(conns[i]->end1,
-                                                NVLINK_LINKSTATE_HS,
-                                                NVLINK_TRANSITION_HS_TIMEOUT);
-        if (pollStatus != NVL_SUCCESS)
-        {
-            status = pollStatus;
-        }
+    status = nvlink_core_poll_links_state(pollLinks, connCount * 2,
+                                          NVLINK_LINKSTATE_HS,
+                                          NVLINK_TRANSITION_HS_TIMEOUT,
+                                          NVLINK_TRAINING_PHASE_HS,
+                                          pollStatus);
+
+    for (i = 0; i < connCount; i++)
+    {
+        if (conns[i] == NULL)
+            continue;
 
         conns[i]->end0->link_handlers->set_dl_link_mode(conns[i]->end0,
                                                         NVLINK_LINKSTATE_INITTL,
@@ -935,9 +1118,34 @@ nvlink_core_train_intranode_conns_from_swcfg_to_active_non_ALI
         }
     }
 
+    _nvlink_core_free_poll_links(pollLinks, connLinks);
+
     return status;
 }
 
+/**
+ * Train intranode connections associated with a list of links to HS
+ * using non-ALI sequence
+ *
+ * @param[in]  conns      Array of connections to train
+ * @param[in]  connCount  Number of connections in the array
+ * @param[in]  flags      Flags to track if training is sync/async
+ *
+ * return NVL_SUCCESS if the connections train successfully
+ */
+NvlStatus
+nvlink_core_train_intranode_conns_from_swcfg_to_active_non_ALI
+(
+    nvlink_intranode_conn **conns,
+    NvU32                   connCount,
+    NvU32                   flags
+)
+{
+    return _nvlink_core_train_intranode_conns_batched(conns, connCount, flags,
+               nvlinkLibCtx.maxParallelTrainConns,
+               _nvlink_core_train_intranode_conns_from_swcfg_to_active_non_ALI);
+}
+
 /**
  * Train intranode connections associated with a list of links to HS
  * using non-ALI sequence
@@ -991,28 +1199,25 @@ nvlink_core_train_intranode_conns_from_off_to_active_ALI
 }
 
 /**
- * Train intranode connections associated with a list of links to HS
- * using ALT sequence
- *
- * @param[in]  conns      Array of connections to train
- * @param[in]  connCount  Number of connections in the array
- * @param[in]  flags      Flags to track if training is sync/async
- *
- * return NVL_SUCCESS if the connections train successfully
+ * Train one batch of intranode connections to HS using the ALT sequence.
+ * See nvlink_core_train_intranode_conns_from_swcfg_to_active_ALT
  */
-NvlStatus
-nvlink_core_train_intranode_conns_from_swcfg_to_active_ALT
+static NvlStatus
+_nvlink_core_train_intranode_conns_from_swcfg_to_active_ALT
 (
     nvlink_intranode_conn **conns,
     NvU32                   connCount,
     NvU32                   flags
 )
 {
-    NvlStatus status     = NVL_SUCCESS;
-    NvlStatus pollStatus = NVL_SUCCESS;
-    NvU64     linkMode   = NVLINK_LINKSTATE_OFF;
-    NvU32     i;
-    NvBool    skipConn[NVLINK_MAX_SYSTEM_LINK_NUM] = {0};
+    NvlStatus     status     = NVL_SUCCESS;
+    nvlink_link **pollLinks  = NULL;
+    NvlStatus    *pollStatus = NULL;
+    nvlink_link  *connLinks[NVLINK_MAX_POLL_LINKS_PER_CONN];
+    NvlStatus     connLinkStatus[NVLINK_MAX_POLL_LINKS_PER_CONN];
+    NvU64         linkMode   = NVLINK_LINKSTATE_OFF;
+    NvU32         i;
+    NvBool        skipConn[NVLINK_MAX_SYSTEM_LINK_NUM] = {0};
 
     if ((conns == NULL) || (connCount == 0))
     {
@@ -1023,6 +1228,15 @@ nvlink_core_train_intranode_conns_from_swcfg_to_active_ALT
         return NVL_ERR_GENERIC;
     }
 
+    status = _nvlink_core_alloc_poll_links(connCount, connLinks, connLinkStatus,
+                                           &pollLinks, &pollStatus);
+    if (status != NVL_SUCCESS)
+    {
+        // Fall back to training and polling one connection at a time
+        return _nvlink_core_train_intranode_conns_batched(conns, connCount, flags, 1,
+                   _nvlink_core_train_intranode_conns_from_swcfg_to_active_ALT);
+    }
+
     for (i = 0; i < connCount; i++)
     {
         if (conns[i] == NULL)
@@ -1118,14 +1332,26 @@ nvlink_core_train_intranode_conns_from_swcfg_to_active_ALT
             continue;
         }
 
-        pollStatus = nvlink_core_poll_link_state(conns[i]->end1,
-                                                NVLINK_LINKSTATE_HS,
-                                                NVLINK_TRANSITION_HS_TIMEOUT);
-        if (pollStatus != NVL_SUCCESS)
+        pollLinks[i] = conns[i]->end1;
+    }
+
+    if (nvlink_core_poll_links_state(pollLinks, connCount,
+                                     NVLINK_LINKSTATE_HS,
+                                     NVLINK_TRANSITION_HS_TIMEOUT,
+                                     NVLINK_TRAINING_PHASE_HS,
+                                     pollStatus) != NVL_SUCCESS)
+    {
+        status = NVL_ERR_INVALID_STATE;
+    }
+
+    for (i = 0; i < connCount; i++)
+    {
+        if ((conns[i] == NULL) || skipConn[i])
         {
-            status = pollStatus;
+            continue;
         }
-        else
+
+        if (pollStatus[i] == NVL_SUCCESS)
         {
             NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_INFO,
                 "%s: Successfully able to set linkstate to ACTIVE for links"
@@ -1177,12 +1403,14 @@ nvlink_core_train_intranode_conns_from_swcfg_to_active_ALT
         }
     }
 
+    _nvlink_core_free_poll_links(pollLinks, connLinks);
+
     return status;
 }
 
 /**
- * Train a single intranode connection associated with a list of links to HS
- * using legacy pre-Ampere sequence
+ * Train intranode connections associated with a list of links to HS
+ * using ALT sequence
  *
  * @param[in]  conns      Array of connections to train
  * @param[in]  connCount  Number of connections in the array
@@ -1191,16 +1419,36 @@ nvlink_core_train_intranode_conns_from_swcfg_to_active_ALT
  * return NVL_SUCCESS if the connections train successfully
  */
 NvlStatus
-nvlink_core_train_intranode_conns_from_swcfg_to_active_legacy
+nvlink_core_train_intranode_conns_from_swcfg_to_active_ALT
 (
     nvlink_intranode_conn **conns,
     NvU32                   connCount,
     NvU32                   flags
 )
 {
-    NvlStatus status     = NVL_SUCCESS;
-    NvlStatus pollStatus = NVL_SUCCESS;
-    NvU32     i;
+    return _nvlink_core_train_intranode_conns_batched(conns, connCount, flags,
+               nvlinkLibCtx.maxParallelTrainConns,
+               _nvlink_core_train_intranode_conns_from_swcfg_to_active_ALT);
+}
+
+/**
+ * Train one batch of intranode connections to HS using the legacy pre-Ampere sequence.
+ * See nvlink_core_train_intranode_conns_from_swcfg_to_active_legacy
+ */
+static NvlStatus
+_nvlink_core_train_intranode_conns_from_swcfg_to_active_legacy
+(
+    nvlink_intranode_conn **conns,
+    NvU32                   connCount,
+    NvU32                   flags
+)
+{
+    NvlStatus     status     = NVL_SUCCESS;
+    nvlink_link **pollLinks  = NULL;
+    NvlStatus    *pollStatus = NULL;
+    nvlink_link  *connLinks[NVLINK_MAX_POLL_LINKS_PER_CONN];
+    NvlStatus     connLinkStatus[NVLINK_MAX_POLL_LINKS_PER_CONN];
+    NvU32         i;
 
     if ((conns == NULL) || (connCount == 0))
     {
@@ -1211,6 +1459,29 @@ nvlink_core_train_intranode_conns_from_swcfg_to_active_legacy
         return NVL_ERR_GENERIC;
     }
 
+    //
+    // Laid out as end0s, end1s, end0s so that the first two thirds pair each
+    // TX sublink with the remote RX sublink one third further on.
+    //
+    status = _nvlink_core_alloc_poll_links(connCount * 3, connLinks, connLinkStatus,
+                                           &pollLinks, &pollStatus);
+    if (status != NVL_SUCCESS)
+    {
+        // Fall back to training and polling one connection at a time
+        return _nvlink_core_train_intranode_conns_batched(conns, connCount, flags, 1,
+                   _nvlink_core_train_intranode_conns_from_swcfg_to_active_legacy);
+    }
+
+    for (i = 0; i < connCount; i++)
+    {
+        if (conns[i] == NULL)
+            continue;
+
+        pollLinks[i]                 = conns[i]->end0;
+        pollLinks[connCount + i]     = conns[i]->end1;
+        pollLinks[2 * connCount + i] = conns[i]->end0;
+    }
+
     // Enable PRBS generator on both ends of the link
     for (i = 0; i < connCount; i++)
     {
@@ -1236,42 +1507,27 @@ nvlink_core_train_intranode_conns_from_swcfg_to_active_legacy
     }
 
     // Wait for sublinks to go in High Speed.
-    for (i = 0; i < connCount; i++)
+    nvlink_core_poll_links_sublink_state(pollLinks,
+                                         NVLINK_SUBLINK_STATE_TX_HS,
+                                         NVLINK_SUBLINK_SUBSTATE_TX_STABLE,
+                                         pollLinks + connCount,
+                                         NVLINK_SUBLINK_STATE_RX_HS,
+                                         NVLINK_SUBLINK_SUBSTATE_RX_STABLE,
+                                         connCount * 2,
+                                         NVLINK_TRANSITION_HS_TIMEOUT,
+                                         NVLINK_TRAINING_PHASE_SUBLINK_HS,
+                                         pollStatus);
+
+    for (i = 0; i < connCount * 2; i++)
     {
-        if (conns[i] == NULL)
+        if ((pollLinks[i] == NULL) || (pollStatus[i] == NVL_SUCCESS))
             continue;
 
-        pollStatus = nvlink_core_poll_sublink_state(conns[i]->end0,
-                                                    NVLINK_SUBLINK_STATE_TX_HS,
-                                                    NVLINK_SUBLINK_SUBSTATE_TX_STABLE,
-                                                    conns[i]->end1,
-                                                    NVLINK_SUBLINK_STATE_RX_HS,
-                                                    NVLINK_SUBLINK_SUBSTATE_RX_STABLE,
-                                                    NVLINK_TRANSITION_HS_TIMEOUT);
-        if (pollStatus != NVL_SUCCESS)
-        {
-            NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
-                "%s: Unable to set sublinks in High Speed mode",
-                __FUNCTION__));
-
-            status = pollStatus;
-        }
-
-        pollStatus = nvlink_core_poll_sublink_state(conns[i]->end1,
-                                                    NVLINK_SUBLINK_STATE_TX_HS,
-                                                    NVLINK_SUBLINK_SUBSTATE_TX_STABLE,
-                                                    conns[i]->end0,
-                                                    NVLINK_SUBLINK_STATE_RX_HS,
-                                                    NVLINK_SUBLINK_SUBSTATE_RX_STABLE,
-                                                    NVLINK_TRANSITION_HS_TIMEOUT);
-        if (pollStatus != NVL_SUCCESS)
-        {
-            NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
-                "%s: Unable to set sublinks in High Speed mode",
-                __FUNCTION__));
+        NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+            "%s: Unable to set sublinks in High Speed mode",
+            __FUNCTION__));
 
-            status = pollStatus;
-        }
+        status = pollStatus[i];
     }
 
     // Some settings required before moving to ACTIVE
@@ -1293,15 +1549,18 @@ nvlink_core_train_intranode_conns_from_swcfg_to_active_legacy
     }
 
     // Verify link mode HS on the endpoints
+    nvlink_core_poll_links_state(pollLinks + connCount, connCount,
+                                 NVLINK_LINKSTATE_HS,
+                                 NVLINK_TRANSITION_HS_TIMEOUT,
+                                 NVLINK_TRAINING_PHASE_HS,
+                                 pollStatus);
+
     for (i = 0; i < connCount; i++)
     {
         if (conns[i] == NULL)
             continue;
 
-        pollStatus = nvlink_core_poll_link_state(conns[i]->end1,
-                                                 NVLINK_LINKSTATE_HS,
-                                                 NVLINK_TRANSITION_HS_TIMEOUT);
-        if (pollStatus == NVL_SUCCESS)
+        if (pollStatus[i] == NVL_SUCCESS)
         {
             NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_INFO,
                 "%s: Successfully able to train an intranode connection to Active",
@@ -1343,9 +1602,34 @@ nvlink_core_train_intranode_conns_from_swcfg_to_active_legacy
                                                         flags);
     }
 
+    _nvlink_core_free_poll_links(pollLinks, connLinks);
+
     return status;
 }
 
+/**
+ * Train a single intranode connection associated with a list of links to HS
+ * using legacy pre-Ampere sequence
+ *
+ * @param[in]  conns      Array of connections to train
+ * @param[in]  connCount  Number of connections in the array
+ * @param[in]  flags      Flags to track if training is sync/async
+ *
+ * return NVL_SUCCESS if the connections train successfully
+ */
+NvlStatus
+nvlink_core_train_intranode_conns_from_swcfg_to_active_legacy
+(
+    nvlink_intranode_conn **conns,
+    NvU32                   connCount,
+    NvU32                   flags
+)
+{
+    return _nvlink_core_train_intranode_conns_batched(conns, connCount, flags,
+               nvlinkLibCtx.maxParallelTrainConns,
+               _nvlink_core_train_intranode_conns_from_swcfg_to_active_legacy);
+}
+
 /**
  * Miscellaneous pre High Speed settings.
  *   Do all the sublink specific settings before it is trained to HS mode
@@ -59,6 +59,8 @@ static NvlStatus nvlink_lib_ctrl_get_devices_info(nvlink_get_devices_info *);
 static NvlStatus nvlink_lib_ctrl_acquire_capability(nvlink_ioctrl_params *, nvlink_acquire_capability *);
 static NvlStatus nvlink_lib_ctrl_get_link_state(nvlink_get_link_state *);
 static NvlStatus nvlink_lib_ctrl_get_device_link_states(nvlink_get_device_link_states *);
+static NvlStatus nvlink_lib_ctrl_get_device_link_training_times(nvlink_get_device_link_training_times *);
+static NvlStatus nvlink_lib_ctrl_set_training_concurrency(nvlink_set_training_concurrency *);
 
 /**
  * Entry point for IOCTLs into the NVLink core library
@@ -417,6 +419,34 @@ nvlink_lib_ioctl_ctrl_helper
             break;
         }
 
+        case CTRL_NVLINK_GET_DEVICE_LINK_TRAINING_TIMES:
+        {
+            nvlink_get_device_link_training_times *iocReq;
+
+            iocReq = NVLINK_IOC_GET_BUF(ctrlParams, nvlink_get_device_link_training_times);
+            if (!iocReq)
+            {
+                return NVL_BAD_ARGS;
+            }
+
+            iocReq->status = nvlink_lib_ctrl_get_device_link_training_times(iocReq);
+            break;
+        }
+
+        case CTRL_NVLINK_SET_TRAINING_CONCURRENCY:
+        {
+            nvlink_set_training_concurrency *iocReq;
+
+            iocReq = NVLINK_IOC_GET_BUF(ctrlParams, nvlink_set_training_concurrency);
+            if (!iocReq)
+            {
+                return NVL_BAD_ARGS;
+            }
+
+            iocReq->status = nvlink_lib_ctrl_set_training_concurrency(iocReq);
+            break;
+        }
+
         case CTRL_NVLINK_RESERVED_0:
         case CTRL_NVLINK_RESERVED_1:
         case CTRL_NVLINK_RESERVED_2:
@@ -1008,6 +1038,7 @@ nvlink_lib_ctrl_device_link_init_status
     nvlink_link   *link     = NULL;
     NvU32          numLinks = 0;
     NvU32          i        = 0;
+    NvlStatus      linkStatus[NVLINK_MAX_DEVICE_CONN];
 
     nvlink_link   **links = (nvlink_link **)nvlink_malloc(
                             sizeof(nvlink_link *) * NVLINK_MAX_SYSTEM_LINK_NUM);
@@ -1086,29 +1117,29 @@ nvlink_lib_ctrl_device_link_init_status
     //
     nvlink_lib_top_lock_release();
 
-    // Poll for links to reach SAFE/SWCFG and capture the status
-    for (i = 0; i < numLinks; i++)
+    // status index should be within NVLINK_MAX_DEVICE_CONN
+    if (numLinks > NVLINK_MAX_DEVICE_CONN)
     {
-        // status index should be within NVLINK_MAX_DEVICE_CONN
-        if (i >= NVLINK_MAX_DEVICE_CONN)
-        {
-            NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
-                "%s: number of links for the device >= NVLINK_MAX_DEVICE_CONN",
-                __FUNCTION__));
+        NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+            "%s: number of links for the device >= NVLINK_MAX_DEVICE_CONN",
+            __FUNCTION__));
 
-            nvlink_assert(0);
+        nvlink_assert(0);
 
-            nvlink_lib_link_locks_release(links, numLinks);
-            nvlink_free((void *)links);
-            return NVL_ERR_INVALID_STATE;
-        }
+        nvlink_lib_link_locks_release(links, numLinks);
+        nvlink_free((void *)links);
+        return NVL_ERR_INVALID_STATE;
+    }
 
-        status = nvlink_core_wait_for_link_init(links[i]);
+    // Poll for links to reach SAFE/SWCFG and capture the status
+    nvlink_core_wait_for_links_init(links, numLinks, linkStatus);
 
+    for (i = 0; i < numLinks; i++)
+    {
         // indicate link init state to user
         statusParams->linkStatus[i].linkIndex = links[i]->linkNumber;
 
-        if (status == NVL_SUCCESS)
+        if (linkStatus[i] == NVL_SUCCESS)
         {
             statusParams->linkStatus[i].initStatus = NV_TRUE;
         }
@@ -3808,3 +3839,118 @@ nvlink_lib_ctrl_get_device_link_states
 
     return status;
 }
+
+static NvlStatus
+nvlink_lib_ctrl_get_device_link_training_times
+(
+    nvlink_get_device_link_training_times *params
+)
+{
+    nvlink_link   *endpoint = NULL;
+    nvlink_device *dev      = NULL;
+    NvlStatus      status   = NVL_SUCCESS;
+    NvU32          numLinks = 0;
+
+    nvlink_link   **links = (nvlink_link **)nvlink_malloc(
+                            sizeof(nvlink_link *) * NVLINK_MAX_DEVICE_CONN);
+    if (links == NULL)
+    {
+        return NVL_NO_MEM;
+    }
+
+    nvlink_memset(params->linkTimes, 0x0, sizeof(params->linkTimes));
+
+    // Acquire the top-level lock
+    status = nvlink_lib_top_lock_acquire();
+    if (status != NVL_SUCCESS)
+    {
+        NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+            "%s: Failed to acquire top-level lock\n",
+            __FUNCTION__));
+
+        nvlink_free((void *)links);
+        return status;
+    }
+
+    // look-up user requested nvlink device object
+    nvlink_core_get_device_by_devinfo(&params->devInfo, &dev);
+    if (dev == NULL)
+    {
+        nvlink_lib_top_lock_release();
+
+        nvlink_free((void *)links);
+        return NVL_BAD_ARGS;
+    }
+
+    FOR_EACH_LINK_REGISTERED(endpoint, dev, node)
+    {
+        if ((numLinks >= NVLINK_MAX_DEVICE_CONN) ||
+            (endpoint->linkNumber >= NVLINK_MAX_DEVICE_CONN))
+        {
+            NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+                "%s: numLinks >= NVLINK_MAX_DEVICE_CONN",
+                __FUNCTION__));
+
+            nvlink_assert(0);
+
+            nvlink_lib_top_lock_release();
+            nvlink_free((void *)links);
+            return NVL_ERR_INVALID_STATE;
+        }
+        links[numLinks] = endpoint;
+        numLinks++;
+    }
+
+    // Acquire the per-link locks
+    status = nvlink_lib_link_locks_acquire(links, numLinks);
+    if (status != NVL_SUCCESS)
+    {
+        NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+            "%s: Failed to acquire per-link locks\n",
+            __FUNCTION__));
+
+        nvlink_lib_top_lock_release();
+        nvlink_free((void *)links);
+        return status;
+    }
+
+    nvlink_lib_top_lock_release();
+
+    FOR_EACH_LINK_REGISTERED(endpoint, dev, node)
+    {
+        params->linkTimes[endpoint->linkNumber] = endpoint->trainingTimes;
+    }
+
+    // Release the per-link locks
+    nvlink_lib_link_locks_release(links, numLinks);
+
+    nvlink_free((void *)links);
+
+    return NVL_SUCCESS;
+}
+
+static NvlStatus
+nvlink_lib_ctrl_set_training_concurrency
+(
+    nvlink_set_training_concurrency *params
+)
+{
+    NvlStatus status = NVL_SUCCESS;
+
+    // Acquire the top-level lock
+    status = nvlink_lib_top_lock_acquire();
+    if (status != NVL_SUCCESS)
+    {
+        NVLINK_PRINT((DBG_MODULE_NVLINK_CORE, NVLINK_DBG_LEVEL_ERRORS,
+            "%s: Failed to acquire top-level lock\n",
+            __FUNCTION__));
+
+        return status;
+    }
+
+    nvlinkLibCtx.maxParallelTrainConns = params->maxConns;
+
+    nvlink_lib_top_lock_release();
+
+    return NVL_SUCCESS;
+}
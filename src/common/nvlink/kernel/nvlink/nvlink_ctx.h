@@ -82,6 +82,12 @@ typedef struct
      * ioctls, which operate on endpoints.
      */
     NvU16 nodeId;
+
+    /*
+     * Maximum number of intranode connections trained to ACTIVE together.
+     * Set by ioctl interface, 0 means all requested connections at once.
+     */
+    NvU32 maxParallelTrainConns;
 }nvlink_lib_context;
 
 extern nvlink_lib_context nvlinkLibCtx;
@@ -121,6 +121,13 @@ NvlStatus nvlink_core_link_init_async(nvlink_link **links, NvU32 numLinks);
  */
 NvlStatus nvlink_core_wait_for_link_init(nvlink_link *link);
 
+/**
+ * Poll on SAFE/SWCFG on the given array of links together
+ */
+NvlStatus nvlink_core_wait_for_links_init(nvlink_link **links,
+                                          NvU32         numLinks,
+                                          NvlStatus    *linkStatus);
+
 /**
  * Initialize all the endpoints from OFF to SWCFG state
  */
@@ -402,6 +409,41 @@ NvlStatus nvlink_core_poll_rx_sublink_state(nvlink_link *link,
                                             NvU32        rxSublinkSubState,
                                             NvU32        timeout);
 
+// Training phase for polls whose duration is not recorded against the link
+#define NVLINK_TRAINING_PHASE_NONE  NVLINK_TRAINING_PHASE_COUNT
+
+/**
+ * Clear the training times recorded by the link for the given phase and the ones after it
+ */
+void nvlink_core_clear_training_times(nvlink_link *link, NvU32 firstPhase);
+
+/**
+ * Poll a set of links together for each to reach the particular state. The links
+ * share one timeout and each link's wait is recorded against the given training phase
+ */
+NvlStatus nvlink_core_poll_links_state(nvlink_link **links,
+                                       NvU32         numLinks,
+                                       NvU64         linkState,
+                                       NvU32         timeout,
+                                       NvU32         phase,
+                                       NvlStatus    *linkStatus);
+
+/**
+ * Poll a set of tx/rx sublink pairs together for each pair to reach the particular
+ * states. The pairs share one timeout and each pair's wait is recorded against the
+ * given training phase
+ */
+NvlStatus nvlink_core_poll_links_sublink_state(nvlink_link **txLinks,
+                                               NvU64         txSublinkState,
+                                               NvU32         txSublinkSubState,
+                                               nvlink_link **rxLinks,
+                                               NvU64         rxSublinkState,
+                                               NvU32         rxSublinkSubState,
+                                               NvU32         numLinks,
+                                               NvU32         timeout,
+                                               NvU32         phase,
+                                               NvlStatus    *linkStatus);
+
 /************************************************************************************************/
 /****************** Nvlink print functions for devices/links/connections ************************/
 /************************************************************************************************/
@@ -1345,6 +1345,71 @@ typedef struct nvswitch_get_errors
     NVSWITCH_ERROR error[NVSWITCH_ERROR_COUNT_SIZE];
 } NVSWITCH_GET_ERRORS_PARAMS;
 
+/*
+ * CTRL_NVSWITCH_GET_ERROR_RECORDS
+ *
+ * Control to drain error information in bulk.
+ *
+ * Records use the same numbering as CTRL_NVSWITCH_GET_ERRORS but carry no
+ * description string, so roughly twice as many fit in one call.  Clients
+ * derive a description from error_value.
+ *
+ * Parameters:
+ *   errorType [IN]
+ *      Allows to query specific class of errors. See NVSWITCH_ERROR_SEVERITY_xxx.
+ *
+ *   cursor [IN/OUT]
+ *      On input: The index of the first error of the specified 'errorType' at which to start
+ *                reading out of the driver.
+ *
+ *      On output: The index of the first error that wasn't returned through the 'record'
+ *                 array. Pass it back unchanged to continue draining.
+ *
+ *   nextErrorIndex [OUT]
+ *      The index that will be assigned to the next error to occur for the specified 'errorType'.
+ *
+ *   droppedCount [OUT]
+ *      Number of errors between the input cursor and the oldest error still held by
+ *      the driver. These were overwritten before they could be read.
+ *
+ *   droppedTotal [OUT]
+ *      Number of errors of the specified 'errorType' overwritten or not retained by
+ *      the driver since it was loaded.
+ *
+ *   recordCount [OUT]
+ *      Number of records returned by the call. A client has drained the log once
+ *      recordCount is less than NVSWITCH_ERROR_RECORD_COUNT_SIZE.
+ *
+ *   record [OUT]
+ *      The error records, oldest first.
+ */
+
+#define NVSWITCH_ERROR_RECORD_COUNT_SIZE 128
+
+typedef struct nvswitch_error_record
+{
+    NV_DECLARE_ALIGNED(NvU64 errorIndex, 8); /* Index of this error, see 'cursor' */
+    NV_DECLARE_ALIGNED(NvU64 time, 8);  /* Platform time (nsec) */
+    NvU32  error_value;                 /* NVSWITCH_ERR_* */
+    NvU32  error_src;                   /* NVSWITCH_ERROR_SRC_* */
+    NvU32  instance;                    /* Used for link# or subengine instance */
+    NvU32  subinstance;                 /* Used for lane# or similar */
+    NvBool error_resolved;              /* If an error is correctable, set to true. */
+    NvU32  error_data_size;             /* Size of error_data */
+    NvU32  error_data[NVSWITCH_RAW_ERROR_DATA_SIZE]; /* Data from NVSWITCH_REPORT_DATA */
+} NVSWITCH_ERROR_RECORD;
+
+typedef struct nvswitch_get_error_records_params
+{
+    NvU32                 errorType;
+    NV_DECLARE_ALIGNED(NvU64 cursor, 8);
+    NV_DECLARE_ALIGNED(NvU64 nextErrorIndex, 8);
+    NV_DECLARE_ALIGNED(NvU64 droppedCount, 8);
+    NV_DECLARE_ALIGNED(NvU64 droppedTotal, 8);
+    NvU32                 recordCount;
+    NVSWITCH_ERROR_RECORD record[NVSWITCH_ERROR_RECORD_COUNT_SIZE];
+} NVSWITCH_GET_ERROR_RECORDS_PARAMS;
+
 /*
 * CTRL_NVSWITCH_GET_PORT_EVENTS
 *
@@ -4693,6 +4758,7 @@ typedef struct nvswitch_get_tnvl_status_params
 #define CTRL_NVSWITCH_GET_ATTESTATION_CERTIFICATE_CHAIN     0x6A
 #define CTRL_NVSWITCH_GET_ATTESTATION_REPORT                0x6B
 #define CTRL_NVSWITCH_GET_TNVL_STATUS                       0x6C
+#define CTRL_NVSWITCH_GET_ERROR_RECORDS                     0x6D
 
 #ifdef __cplusplus
 }
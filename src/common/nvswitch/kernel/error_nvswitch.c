@@ -158,15 +158,10 @@ nvswitch_record_error
 )
 {
     NvU32 idx_error;
-    NvU32 description_len = (NvU32)nvswitch_os_strlen(description) - 2; //take out leading and trailing quotation
+    NVSWITCH_ERROR_TYPE *error_entry;
 
     NVSWITCH_ASSERT(errors != NULL);
-    NVSWITCH_ASSERT(data_size <= sizeof(errors->error_log[idx_error].data));
-
-    if (description_len > NVSWITCH_ERROR_MAX_DESCRPTION_LEN)
-    {
-        description_len = NVSWITCH_ERROR_MAX_DESCRPTION_LEN;
-    }
+    NVSWITCH_ASSERT(data_size <= sizeof(error_entry->data));
 
     // If no error log has been created, don't log it.
     if ((errors->error_log_size != 0) && (errors->error_log != NULL))
@@ -176,6 +171,8 @@ nvswitch_record_error
         if (errors->error_count == errors->error_log_size)
         {
             // Error ring buffer already full.
+            errors->error_dropped++;
+
             if (errors->overwritable)
             {
                 errors->error_start = (errors->error_start + 1) % errors->error_log_size;
@@ -191,36 +188,82 @@ nvswitch_record_error
             errors->error_count++;
         }
 
+        error_entry = &errors->error_log[idx_error];
+
         // Log error info
-        errors->error_log[idx_error].error_type = error_type;
-        errors->error_log[idx_error].instance   = instance;
-        errors->error_log[idx_error].subinstance = subinstance;
-        errors->error_log[idx_error].error_src  = error_src;
-        errors->error_log[idx_error].severity   = severity;
-        errors->error_log[idx_error].error_resolved = error_resolved;
-        errors->error_log[idx_error].line       = line;
-        errors->error_log[idx_error].data_size  = data_size;
-        nvswitch_os_memcpy(&errors->error_log[idx_error].description, description + 1, description_len);
+        error_entry->error_type = error_type;
+        error_entry->instance   = instance;
+        error_entry->subinstance = subinstance;
+        error_entry->error_src  = error_src;
+        error_entry->severity   = severity;
+        error_entry->error_resolved = error_resolved;
+        error_entry->line       = line;
+        error_entry->data_size  = data_size;
+
+        // The description is a string literal; it is only formatted when read.
+        error_entry->description = description;
 
         // Log tracking info
-        errors->error_log[idx_error].timer_count = nvswitch_hw_counter_read_counter(device);
-        errors->error_log[idx_error].time = nvswitch_os_get_platform_time();
-        errors->error_log[idx_error].local_error_num  = errors->error_total;
-        errors->error_log[idx_error].global_error_num = device->error_total;
-
-        // Copy ancillary data blob
-        nvswitch_os_memset(&errors->error_log[idx_error].data, 0, sizeof(errors->error_log[idx_error].data));
-        if ((data != NULL) && (data_size > 0))
+        error_entry->timer_count = nvswitch_hw_counter_read_counter(device);
+        error_entry->time = nvswitch_os_get_platform_time();
+        error_entry->local_error_num  = errors->error_total;
+        error_entry->global_error_num = device->error_total;
+
+        // Copy ancillary data blob, clearing only what it does not cover
+        if ((data == NULL) || (data_size > sizeof(error_entry->data)))
+        {
+            data_size = 0;
+        }
+        if (data_size > 0)
+        {
+            nvswitch_os_memcpy(&error_entry->data, data, data_size);
+        }
+        if (data_size < sizeof(error_entry->data))
         {
-            nvswitch_os_memcpy(&errors->error_log[idx_error].data, data, data_size);
+            nvswitch_os_memset((NvU8 *)&error_entry->data + data_size, 0,
+                               sizeof(error_entry->data) - data_size);
         }
 
-        _nvswitch_dump_error_entry(device, idx_error, &errors->error_log[idx_error]);
+        _nvswitch_dump_error_entry(device, idx_error, error_entry);
     }
     errors->error_total++;
     device->error_total++;
 }
 
+//
+// Format a logged description into a fixed-size client buffer.
+//
+// Descriptions are stringified at the reporting site, so they carry a leading
+// and trailing quote which are dropped here.  The result is not terminated if
+// it fills the buffer.
+//
+static void
+_nvswitch_format_error_description
+(
+    NvU8       *buffer,
+    NvU32       buffer_size,
+    const char *description
+)
+{
+    NvLength description_len;
+
+    nvswitch_os_memset(buffer, 0, buffer_size);
+
+    if (description == NULL)
+    {
+        return;
+    }
+
+    description_len = nvswitch_os_strlen(description);
+    if (description_len <= 2)
+    {
+        return;
+    }
+
+    description_len = NV_MIN(description_len - 2, buffer_size);
+    nvswitch_os_memcpy(buffer, description + 1, description_len);
+}
+
 //
 // Discard N errors from the specified log
 //
@@ -570,7 +613,9 @@ nvswitch_ctrl_get_errors
         {
             nvswitch_os_memcpy(p->error[p->errorCount].error_data, error.data.raw.data, error.data_size);
         }
-        nvswitch_os_memcpy(p->error[p->errorCount].error_description, error.description, sizeof(error.description));
+        _nvswitch_format_error_description(p->error[p->errorCount].error_description,
+                                           sizeof(p->error[p->errorCount].error_description),
+                                           error.description);
         
         p->errorCount++;
         index++;
@@ -580,3 +625,83 @@ nvswitch_ctrl_get_errors
 
     return NVL_SUCCESS;
 }
+
+NvlStatus
+nvswitch_ctrl_get_error_records
+(
+    nvswitch_device *device,
+    NVSWITCH_GET_ERROR_RECORDS_PARAMS *p
+)
+{
+    NVSWITCH_ERROR_LOG_TYPE *error_log;
+    NVSWITCH_ERROR_TYPE *error;
+    NVSWITCH_ERROR_RECORD *record;
+    NvU64 oldest_error_num;
+    NvU32 index;
+
+    switch (p->errorType)
+    {
+        case NVSWITCH_ERROR_SEVERITY_FATAL:
+            error_log = &device->log_FATAL_ERRORS;
+            break;
+        case NVSWITCH_ERROR_SEVERITY_NONFATAL:
+            error_log = &device->log_NONFATAL_ERRORS;
+            break;
+        default:
+            return -NVL_BAD_ARGS;
+    }
+
+    p->nextErrorIndex = NVSWITCH_ERROR_NEXT_LOCAL_NUMBER(error_log);
+    p->droppedTotal = error_log->error_dropped;
+    p->droppedCount = 0;
+    p->recordCount = 0;
+
+    //
+    // Entries in the log are numbered consecutively, so anything between the
+    // client's cursor and the oldest retained entry was lost before it could
+    // be read.
+    //
+    oldest_error_num = error_log->error_total - error_log->error_count;
+    if (p->cursor < oldest_error_num)
+    {
+        p->droppedCount = oldest_error_num - p->cursor;
+        p->cursor = oldest_error_num;
+    }
+
+    if (p->cursor >= error_log->error_total)
+    {
+        return NVL_SUCCESS;
+    }
+
+    index = (NvU32)(p->cursor - oldest_error_num);
+
+    while ((p->recordCount < NVSWITCH_ERROR_RECORD_COUNT_SIZE) &&
+           (index < error_log->error_count))
+    {
+        error = &error_log->error_log[(error_log->error_start + index) %
+                                      error_log->error_log_size];
+        record = &p->record[p->recordCount];
+
+        nvswitch_os_memset(record, 0, sizeof(*record));
+        record->errorIndex = error->local_error_num;
+        record->time = error->time;
+        record->error_value = error->error_type;
+        record->error_src = error->error_src;
+        record->instance = error->instance;
+        record->subinstance = error->subinstance;
+        record->error_resolved = error->error_resolved;
+        record->error_data_size = NV_MIN(error->data_size, sizeof(record->error_data));
+        if (record->error_data_size > 0)
+        {
+            nvswitch_os_memcpy(record->error_data, error->data.raw.data,
+                               record->error_data_size);
+        }
+
+        p->recordCount++;
+        index++;
+    }
+
+    p->cursor += p->recordCount;
+
+    return NVL_SUCCESS;
+}
@@ -38,6 +38,7 @@
 #include "inforom/inforom_nvswitch.h"
 #include "spi_nvswitch.h"
 #include "smbpbi_nvswitch.h"
+#include "ingress_shadow_nvswitch.h"
 #include "nvCpuUuid.h"
 #include "fsprpc_nvswitch.h"
 
@@ -440,6 +441,9 @@ struct nvswitch_device
     NvBool                              bModeContinuousALI;
     NVSWITCH_LINK_TYPE                  link[NVSWITCH_MAX_LINK_COUNT];
 
+    // Ingress routing RAM shadows, allocated on first use
+    NVSWITCH_INGRESS_SHADOW             *ingress_shadow[NVSWITCH_INGRESS_SHADOW_TABLE_COUNT][NVSWITCH_MAX_LINK_COUNT];
+
     // PLL
     NVSWITCH_PLL_INFO                   switch_pll;
 
@@ -100,7 +100,7 @@ typedef struct
     NvU64   time;                           // Platform time, in ns
     NvU32   line;
     NvU32   data_size;                      // Size of data
-    NvU8    description[NVSWITCH_ERROR_MAX_DESCRPTION_LEN]; // Short description of error type    
+    const char *description;                // Stringified description from the reporting site, formatted on read
 
     union
     {
@@ -120,6 +120,7 @@ typedef struct
     NvU32               error_log_size; // CB size
     NVSWITCH_ERROR_TYPE *error_log;
     NvBool              overwritable;   // Old CB entries can be overwritten
+    NvU64               error_dropped;  // Count of errors overwritten or not retained
 
 } NVSWITCH_ERROR_LOG_TYPE;
 
@@ -208,6 +209,8 @@ void nvswitch_translate_error(NVSWITCH_ERROR_TYPE *error_entry,
                               NVSWITCH_NVLINK_HW_ERROR *hw_error);
 NvlStatus nvswitch_ctrl_get_errors(nvswitch_device *device,
                                    NVSWITCH_GET_ERRORS_PARAMS *p);
+NvlStatus nvswitch_ctrl_get_error_records(nvswitch_device *device,
+                                          NVSWITCH_GET_ERROR_RECORDS_PARAMS *p);
 
 // Log correctable per-device error with data
 #define NVSWITCH_REPORT_CORRECTABLE_DEVICE_DATA(_device, _logenum, _data, _fmt, ...)    \
@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef _INGRESS_SHADOW_NVSWITCH_H_
+#define _INGRESS_SHADOW_NVSWITCH_H_
+
+#include "nvtypes.h"
+
+struct nvswitch_device;
+
+//
+// Driver-side shadow of the NPORT ingress routing RAMs.
+//
+// Each entry holds the raw values of the RAM's data registers, exactly as
+// written to (or read back from) hardware, so chip code can diff a requested
+// entry against the shadow before programming it, and serve reads without
+// MMIO.  An entry is only trusted once it has been written or read through
+// the shadow; everything else is "unknown" and falls back to hardware.
+//
+// The shadow itself never touches registers, so it can be exercised outside
+// the driver.
+//
+
+#define NVSWITCH_INGRESS_SHADOW_MAX_WORDS   8
+
+typedef enum
+{
+    NVSWITCH_INGRESS_SHADOW_RID = 0,
+    NVSWITCH_INGRESS_SHADOW_RLAN,
+    NVSWITCH_INGRESS_SHADOW_REMAP,
+    NVSWITCH_INGRESS_SHADOW_EXTA_REMAP,
+    NVSWITCH_INGRESS_SHADOW_EXTB_REMAP,
+    NVSWITCH_INGRESS_SHADOW_TABLE_COUNT
+} NVSWITCH_INGRESS_SHADOW_TABLE;
+
+typedef struct
+{
+    NvU32   ram_size;       // Number of RAM entries
+    NvU32   num_words;      // Data registers per RAM entry
+    NvU32  *data;           // ram_size * num_words register values
+    NvU32  *known;          // Bitmask of entries that mirror hardware
+} NVSWITCH_INGRESS_SHADOW;
+
+NVSWITCH_INGRESS_SHADOW *nvswitch_ingress_shadow_get(struct nvswitch_device *device,
+                                                     NVSWITCH_INGRESS_SHADOW_TABLE table,
+                                                     NvU32 port, NvU32 ram_size,
+                                                     NvU32 num_words);
+NvBool nvswitch_ingress_shadow_matches(const NVSWITCH_INGRESS_SHADOW *shadow,
+                                       NvU32 index, const NvU32 *words);
+NvBool nvswitch_ingress_shadow_read(const NVSWITCH_INGRESS_SHADOW *shadow,
+                                    NvU32 index, NvU32 *words);
+void nvswitch_ingress_shadow_update(NVSWITCH_INGRESS_SHADOW *shadow,
+                                    NvU32 index, const NvU32 *words);
+void nvswitch_ingress_shadow_invalidate(NVSWITCH_INGRESS_SHADOW *shadow,
+                                        NvU32 first_index, NvU32 num_entries);
+void nvswitch_ingress_shadow_invalidate_port(struct nvswitch_device *device, NvU32 port);
+void nvswitch_ingress_shadow_destroy(struct nvswitch_device *device);
+
+#endif //_INGRESS_SHADOW_NVSWITCH_H_
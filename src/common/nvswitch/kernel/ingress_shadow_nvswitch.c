@@ -0,0 +1,274 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "common_nvswitch.h"
+#include "ingress_shadow_nvswitch.h"
+
+#define NVSWITCH_INGRESS_SHADOW_KNOWN_WORD(_i)  ((_i) / 32)
+#define NVSWITCH_INGRESS_SHADOW_KNOWN_BIT(_i)   NVBIT((_i) % 32)
+
+static NvBool
+_nvswitch_ingress_shadow_is_known
+(
+    const NVSWITCH_INGRESS_SHADOW *shadow,
+    NvU32 index
+)
+{
+    return ((shadow->known[NVSWITCH_INGRESS_SHADOW_KNOWN_WORD(index)] &
+             NVSWITCH_INGRESS_SHADOW_KNOWN_BIT(index)) != 0);
+}
+
+static void
+_nvswitch_ingress_shadow_free
+(
+    NVSWITCH_INGRESS_SHADOW *shadow
+)
+{
+    if (shadow == NULL)
+    {
+        return;
+    }
+
+    nvswitch_os_free(shadow->data);
+    nvswitch_os_free(shadow->known);
+    nvswitch_os_free(shadow);
+}
+
+/*
+ * @brief Return the shadow of one ingress RAM of one NPORT, allocating it on
+ * first use with every entry unknown.
+ *
+ * Returns NULL if the shadow cannot be allocated, or if the RAM geometry does
+ * not match an existing shadow; all other shadow helpers accept NULL, in
+ * which case callers simply program and read hardware directly.
+ */
+NVSWITCH_INGRESS_SHADOW *
+nvswitch_ingress_shadow_get
+(
+    nvswitch_device *device,
+    NVSWITCH_INGRESS_SHADOW_TABLE table,
+    NvU32 port,
+    NvU32 ram_size,
+    NvU32 num_words
+)
+{
+    NVSWITCH_INGRESS_SHADOW *shadow;
+    NvU32 known_size;
+
+    if ((table >= NVSWITCH_INGRESS_SHADOW_TABLE_COUNT) ||
+        (port >= NVSWITCH_MAX_LINK_COUNT) ||
+        (ram_size == 0) ||
+        (num_words == 0) ||
+        (num_words > NVSWITCH_INGRESS_SHADOW_MAX_WORDS))
+    {
+        NVSWITCH_ASSERT(0);
+        return NULL;
+    }
+
+    shadow = device->ingress_shadow[table][port];
+    if (shadow != NULL)
+    {
+        if ((shadow->ram_size != ram_size) || (shadow->num_words != num_words))
+        {
+            NVSWITCH_ASSERT(0);
+            return NULL;
+        }
+        return shadow;
+    }
+
+    known_size = ((ram_size + 31) / 32) * sizeof(NvU32);
+
+    shadow = nvswitch_os_malloc(sizeof(*shadow));
+    if (shadow == NULL)
+    {
+        return NULL;
+    }
+    nvswitch_os_memset(shadow, 0, sizeof(*shadow));
+
+    shadow->data = nvswitch_os_malloc(ram_size * num_words * sizeof(NvU32));
+    shadow->known = nvswitch_os_malloc(known_size);
+    if ((shadow->data == NULL) || (shadow->known == NULL))
+    {
+        NVSWITCH_PRINT(device, WARN,
+            "%s: Failed to allocate ingress shadow %d for port %d\n",
+            __FUNCTION__, table, port);
+        _nvswitch_ingress_shadow_free(shadow);
+        return NULL;
+    }
+
+    shadow->ram_size = ram_size;
+    shadow->num_words = num_words;
+    nvswitch_os_memset(shadow->known, 0, known_size);
+
+    device->ingress_shadow[table][port] = shadow;
+
+    return shadow;
+}
+
+/*
+ * @brief Return NV_TRUE if hardware is known to already hold 'words' at
+ * 'index', i.e. programming the entry again can be skipped.
+ */
+NvBool
+nvswitch_ingress_shadow_matches
+(
+    const NVSWITCH_INGRESS_SHADOW *shadow,
+    NvU32 index,
+    const NvU32 *words
+)
+{
+    if ((shadow == NULL) ||
+        (index >= shadow->ram_size) ||
+        !_nvswitch_ingress_shadow_is_known(shadow, index))
+    {
+        return NV_FALSE;
+    }
+
+    return (nvswitch_os_memcmp(&shadow->data[index * shadow->num_words], words,
+                               shadow->num_words * sizeof(NvU32)) == 0);
+}
+
+/*
+ * @brief Copy the shadowed register values of entry 'index' into 'words'.
+ *
+ * Returns NV_FALSE, leaving 'words' untouched, if the entry is unknown and
+ * must be read from hardware.
+ */
+NvBool
+nvswitch_ingress_shadow_read
+(
+    const NVSWITCH_INGRESS_SHADOW *shadow,
+    NvU32 index,
+    NvU32 *words
+)
+{
+    if ((shadow == NULL) ||
+        (index >= shadow->ram_size) ||
+        !_nvswitch_ingress_shadow_is_known(shadow, index))
+    {
+        return NV_FALSE;
+    }
+
+    nvswitch_os_memcpy(words, &shadow->data[index * shadow->num_words],
+                       shadow->num_words * sizeof(NvU32));
+
+    return NV_TRUE;
+}
+
+/*
+ * @brief Record that hardware now holds 'words' at 'index'.
+ */
+void
+nvswitch_ingress_shadow_update
+(
+    NVSWITCH_INGRESS_SHADOW *shadow,
+    NvU32 index,
+    const NvU32 *words
+)
+{
+    if ((shadow == NULL) || (index >= shadow->ram_size))
+    {
+        return;
+    }
+
+    nvswitch_os_memcpy(&shadow->data[index * shadow->num_words], words,
+                       shadow->num_words * sizeof(NvU32));
+    shadow->known[NVSWITCH_INGRESS_SHADOW_KNOWN_WORD(index)] |=
+        NVSWITCH_INGRESS_SHADOW_KNOWN_BIT(index);
+}
+
+/*
+ * @brief Forget entries [first_index, first_index + num_entries), e.g. after
+ * they were modified by a path that does not maintain the shadow.
+ */
+void
+nvswitch_ingress_shadow_invalidate
+(
+    NVSWITCH_INGRESS_SHADOW *shadow,
+    NvU32 first_index,
+    NvU32 num_entries
+)
+{
+    NvU32 i;
+
+    if (shadow == NULL)
+    {
+        return;
+    }
+
+    for (i = first_index;
+         (i < first_index + num_entries) && (i < shadow->ram_size);
+         i++)
+    {
+        shadow->known[NVSWITCH_INGRESS_SHADOW_KNOWN_WORD(i)] &=
+            ~NVSWITCH_INGRESS_SHADOW_KNOWN_BIT(i);
+    }
+}
+
+/*
+ * @brief Forget every shadowed entry of a port, after the port was reset or
+ * reported an uncorrectable error in one of its routing RAMs.
+ */
+void
+nvswitch_ingress_shadow_invalidate_port
+(
+    nvswitch_device *device,
+    NvU32 port
+)
+{
+    NvU32 table;
+
+    if (port >= NVSWITCH_MAX_LINK_COUNT)
+    {
+        return;
+    }
+
+    for (table = 0; table < NVSWITCH_INGRESS_SHADOW_TABLE_COUNT; table++)
+    {
+        NVSWITCH_INGRESS_SHADOW *shadow = device->ingress_shadow[table][port];
+
+        if (shadow != NULL)
+        {
+            nvswitch_ingress_shadow_invalidate(shadow, 0, shadow->ram_size);
+        }
+    }
+}
+
+void
+nvswitch_ingress_shadow_destroy
+(
+    nvswitch_device *device
+)
+{
+    NvU32 table;
+    NvU32 port;
+
+    for (table = 0; table < NVSWITCH_INGRESS_SHADOW_TABLE_COUNT; table++)
+    {
+        for (port = 0; port < NVSWITCH_MAX_LINK_COUNT; port++)
+        {
+            _nvswitch_ingress_shadow_free(device->ingress_shadow[table][port]);
+            device->ingress_shadow[table][port] = NULL;
+        }
+    }
+}
@@ -1816,6 +1816,8 @@ _nvswitch_service_ingress_fatal_lr10
         NVSWITCH_REPORT_CONTAIN_DATA(_HW_NPORT_INGRESS_REMAPTAB_ECC_DBE_ERR, data);
         nvswitch_clear_flags(&unhandled, bit);
 
+        nvswitch_ingress_shadow_invalidate_port(device, link);
+
         _nvswitch_construct_ecc_error_event(&err_event,
             NVSWITCH_ERR_HW_NPORT_INGRESS_REMAPTAB_ECC_DBE_ERR, link, bAddressValid,
             address, NV_TRUE, 1);
@@ -1846,6 +1848,8 @@ _nvswitch_service_ingress_fatal_lr10
         NVSWITCH_REPORT_CONTAIN_DATA(_HW_NPORT_INGRESS_RIDTAB_ECC_DBE_ERR, data);
         nvswitch_clear_flags(&unhandled, bit);
 
+        nvswitch_ingress_shadow_invalidate_port(device, link);
+
         _nvswitch_construct_ecc_error_event(&err_event,
             NVSWITCH_ERR_HW_NPORT_INGRESS_RIDTAB_ECC_DBE_ERR, link, bAddressValid,
             address, NV_TRUE, 1);
@@ -1876,6 +1880,8 @@ _nvswitch_service_ingress_fatal_lr10
         NVSWITCH_REPORT_CONTAIN_DATA(_HW_NPORT_INGRESS_RLANTAB_ECC_DBE_ERR, data);
         nvswitch_clear_flags(&unhandled, bit);
 
+        nvswitch_ingress_shadow_invalidate_port(device, link);
+
         _nvswitch_construct_ecc_error_event(&err_event,
             NVSWITCH_ERR_HW_NPORT_INGRESS_RLANTAB_ECC_DBE_ERR, link, bAddressValid,
             address, NV_TRUE, 1);
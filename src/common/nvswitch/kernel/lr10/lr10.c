@@ -1729,6 +1729,8 @@ nvswitch_get_ingress_ram_size_lr10
     return ram_size;
 }
 
+#define NVSWITCH_NUM_REMAP_POLICY_REGS_LR10 5
+
 static void
 _nvswitch_set_remap_policy_lr10
 (
@@ -1744,11 +1746,13 @@ _nvswitch_set_remap_policy_lr10
     NvU32 address_offset;
     NvU32 address_base;
     NvU32 address_limit;
+    NvU32 remap_policy_data[NVSWITCH_NUM_REMAP_POLICY_REGS_LR10];
+    NVSWITCH_INGRESS_SHADOW *shadow;
+    NvBool bSeek = NV_TRUE;
 
-    NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, firstIndex) |
-        DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSREMAPPOLICYRAM) |
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+    shadow = nvswitch_ingress_shadow_get(device, NVSWITCH_INGRESS_SHADOW_REMAP, portNum,
+        nvswitch_get_ingress_ram_size(device, NV_INGRESS_REQRSPMAPADDR_RAM_SEL_SELECTSREMAPPOLICYRAM),
+        NVSWITCH_NUM_REMAP_POLICY_REGS_LR10);
 
     for (i = 0; i < numEntries; i++)
     {
@@ -1758,24 +1762,48 @@ _nvswitch_set_remap_policy_lr10
         address_base = DRF_VAL64(_INGRESS, _REMAP, _ADR_BASE_PHYS_LR10, remap_policy[i].addressBase);
         address_limit = DRF_VAL64(_INGRESS, _REMAP, _ADR_LIMIT_PHYS_LR10, remap_policy[i].addressLimit);
 
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA1,
+        remap_policy_data[0] =
+            DRF_NUM(_INGRESS, _REMAPTABDATA0, _RMAP_ADDR, remap_address) |
+            DRF_NUM(_INGRESS, _REMAPTABDATA0, _IRL_SEL, remap_policy[i].irlSelect) |
+            DRF_NUM(_INGRESS, _REMAPTABDATA0, _ACLVALID, remap_policy[i].entryValid);
+        remap_policy_data[1] =
             DRF_NUM(_INGRESS, _REMAPTABDATA1, _REQCTXT_MSK, remap_policy[i].reqCtxMask) |
-            DRF_NUM(_INGRESS, _REMAPTABDATA1, _REQCTXT_CHK, remap_policy[i].reqCtxChk));
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA2,
+            DRF_NUM(_INGRESS, _REMAPTABDATA1, _REQCTXT_CHK, remap_policy[i].reqCtxChk);
+        remap_policy_data[2] =
             DRF_NUM(_INGRESS, _REMAPTABDATA2, _REQCTXT_REP, remap_policy[i].reqCtxRep) |
-            DRF_NUM(_INGRESS, _REMAPTABDATA2, _ADR_OFFSET, address_offset));
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA3,
+            DRF_NUM(_INGRESS, _REMAPTABDATA2, _ADR_OFFSET, address_offset);
+        remap_policy_data[3] =
             DRF_NUM(_INGRESS, _REMAPTABDATA3, _ADR_BASE, address_base) |
-            DRF_NUM(_INGRESS, _REMAPTABDATA3, _ADR_LIMIT, address_limit));
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA4,
+            DRF_NUM(_INGRESS, _REMAPTABDATA3, _ADR_LIMIT, address_limit);
+        remap_policy_data[4] =
             DRF_NUM(_INGRESS, _REMAPTABDATA4, _TGTID, remap_policy[i].targetId) |
-            DRF_NUM(_INGRESS, _REMAPTABDATA4, _RFUNC, remap_policy[i].flags));
+            DRF_NUM(_INGRESS, _REMAPTABDATA4, _RFUNC, remap_policy[i].flags);
+
+        // Skip entries hardware already holds; re-seek once the run breaks.
+        if (nvswitch_ingress_shadow_matches(shadow, firstIndex + i, remap_policy_data))
+        {
+            bSeek = NV_TRUE;
+            continue;
+        }
+
+        if (bSeek)
+        {
+            NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
+                DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, firstIndex + i) |
+                DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSREMAPPOLICYRAM) |
+                DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+            bSeek = NV_FALSE;
+        }
+
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA1, remap_policy_data[1]);
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA2, remap_policy_data[2]);
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA3, remap_policy_data[3]);
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA4, remap_policy_data[4]);
 
         // Write last and auto-increment
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA0,
-            DRF_NUM(_INGRESS, _REMAPTABDATA0, _RMAP_ADDR, remap_address) |
-            DRF_NUM(_INGRESS, _REMAPTABDATA0, _IRL_SEL, remap_policy[i].irlSelect) |
-            DRF_NUM(_INGRESS, _REMAPTABDATA0, _ACLVALID, remap_policy[i].entryValid));
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA0, remap_policy_data[0]);
+
+        nvswitch_ingress_shadow_update(shadow, firstIndex + i, remap_policy_data);
     }
 }
 
@@ -1975,8 +2003,6 @@ nvswitch_ctrl_set_remap_policy_lr10
  * CTRL_NVSWITCH_GET_REMAP_POLICY
  */
 
-#define NVSWITCH_NUM_REMAP_POLICY_REGS_LR10 5
-
 NvlStatus
 nvswitch_ctrl_get_remap_policy_lr10
 (
@@ -1993,6 +2019,8 @@ nvswitch_ctrl_get_remap_policy_lr10
     NvU32 address_base;
     NvU32 address_limit;
     NvU32 ram_size;
+    NVSWITCH_INGRESS_SHADOW *shadow;
+    NvBool bSeek = NV_TRUE;
 
     if (!NVSWITCH_IS_LINK_ENG_VALID_LR10(device, NPORT, params->portNum))
     {
@@ -2026,20 +2054,36 @@ nvswitch_ctrl_get_remap_policy_lr10
     remap_policy = params->entry;
     remap_count = 0;
 
-    /* set table offset */
-    NVSWITCH_LINK_WR32_LR10(device, params->portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, params->firstIndex) |
-        DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSREMAPPOLICYRAM) |
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+    shadow = nvswitch_ingress_shadow_get(device, NVSWITCH_INGRESS_SHADOW_REMAP,
+        params->portNum, ram_size, NVSWITCH_NUM_REMAP_POLICY_REGS_LR10);
 
     while (remap_count < NVSWITCH_REMAP_POLICY_ENTRIES_MAX &&
         table_index < ram_size)
     {
-        remap_policy_data[0] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA0);
-        remap_policy_data[1] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA1);
-        remap_policy_data[2] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA2);
-        remap_policy_data[3] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA3);
-        remap_policy_data[4] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA4);
+        if (nvswitch_ingress_shadow_read(shadow, table_index, remap_policy_data))
+        {
+            bSeek = NV_TRUE;
+        }
+        else
+        {
+            if (bSeek)
+            {
+                /* set table offset */
+                NVSWITCH_LINK_WR32_LR10(device, params->portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
+                    DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, table_index) |
+                    DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSREMAPPOLICYRAM) |
+                    DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+                bSeek = NV_FALSE;
+            }
+
+            remap_policy_data[0] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA0);
+            remap_policy_data[1] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA1);
+            remap_policy_data[2] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA2);
+            remap_policy_data[3] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA3);
+            remap_policy_data[4] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA4);
+
+            nvswitch_ingress_shadow_update(shadow, table_index, remap_policy_data);
+        }
 
         /* add to remap_entries list if nonzero */
         if (remap_policy_data[0] || remap_policy_data[1] || remap_policy_data[2] ||
@@ -2117,6 +2161,7 @@ nvswitch_ctrl_set_remap_policy_valid_lr10
     NvU32 remap_policy_data[NVSWITCH_NUM_REMAP_POLICY_REGS_LR10]; // 5 REMAP tables
     NvU32 i;
     NvU32 ram_size;
+    NVSWITCH_INGRESS_SHADOW *shadow;
 
     if (!NVSWITCH_IS_LINK_ENG_VALID_LR10(device, NPORT, p->portNum))
     {
@@ -2147,6 +2192,9 @@ nvswitch_ctrl_set_remap_policy_valid_lr10
         return -NVL_BAD_ARGS;
     }
 
+    shadow = nvswitch_ingress_shadow_get(device, NVSWITCH_INGRESS_SHADOW_REMAP,
+        p->portNum, ram_size, NVSWITCH_NUM_REMAP_POLICY_REGS_LR10);
+
     // Select REMAPPOLICY RAM and disable Auto Increament.
     remap_ram =
         DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSREMAPPOLICYRAM) |
@@ -2172,6 +2220,8 @@ nvswitch_ctrl_set_remap_policy_valid_lr10
         NVSWITCH_LINK_WR32_LR10(device, p->portNum, NPORT, _INGRESS, _REMAPTABDATA2, remap_policy_data[2]);
         NVSWITCH_LINK_WR32_LR10(device, p->portNum, NPORT, _INGRESS, _REMAPTABDATA1, remap_policy_data[1]);
         NVSWITCH_LINK_WR32_LR10(device, p->portNum, NPORT, _INGRESS, _REMAPTABDATA0, remap_policy_data[0]);
+
+        nvswitch_ingress_shadow_update(shadow, ram_address - 1, remap_policy_data);
     }
 
     return NVL_SUCCESS;
@@ -2195,6 +2245,8 @@ nvswitch_ctrl_set_remap_policy_valid_lr10
  * CTRL_NVSWITCH_SET_ROUTING_ID
  */
 
+#define NVSWITCH_NUM_RIDTABDATA_REGS_LR10 6
+
 static void
 _nvswitch_set_routing_id_lr10
 (
@@ -2207,59 +2259,60 @@ _nvswitch_set_routing_id_lr10
 {
     NvU32 i;
     NvU32 rmod;
+    NvU32 rid_tab_data[NVSWITCH_NUM_RIDTABDATA_REGS_LR10];
+    NVSWITCH_INGRESS_SHADOW *shadow;
+    NvBool bSeek = NV_TRUE;
 
-    NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, firstIndex) |
-        DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSRIDROUTERAM) |
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+    shadow = nvswitch_ingress_shadow_get(device, NVSWITCH_INGRESS_SHADOW_RID, portNum,
+        nvswitch_get_ingress_ram_size(device, NV_INGRESS_REQRSPMAPADDR_RAM_SEL_SELECTSRIDROUTERAM),
+        NVSWITCH_NUM_RIDTABDATA_REGS_LR10);
 
     for (i = 0; i < numEntries; i++)
     {
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA1,
+        rid_tab_data[1] =
             DRF_NUM(_INGRESS, _RIDTABDATA1, _PORT3,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 3)) |
             DRF_NUM(_INGRESS, _RIDTABDATA1, _VC_MODE3, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 3))   |
             DRF_NUM(_INGRESS, _RIDTABDATA1, _PORT4,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 4)) |
             DRF_NUM(_INGRESS, _RIDTABDATA1, _VC_MODE4, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 4))   |
             DRF_NUM(_INGRESS, _RIDTABDATA1, _PORT5,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 5)) |
-            DRF_NUM(_INGRESS, _RIDTABDATA1, _VC_MODE5, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 5)));
+            DRF_NUM(_INGRESS, _RIDTABDATA1, _VC_MODE5, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 5));
 
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA2,
+        rid_tab_data[2] =
             DRF_NUM(_INGRESS, _RIDTABDATA2, _PORT6,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 6)) |
             DRF_NUM(_INGRESS, _RIDTABDATA2, _VC_MODE6, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 6))   |
             DRF_NUM(_INGRESS, _RIDTABDATA2, _PORT7,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 7)) |
             DRF_NUM(_INGRESS, _RIDTABDATA2, _VC_MODE7, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 7))   |
             DRF_NUM(_INGRESS, _RIDTABDATA2, _PORT8,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 8)) |
-            DRF_NUM(_INGRESS, _RIDTABDATA2, _VC_MODE8, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 8)));
+            DRF_NUM(_INGRESS, _RIDTABDATA2, _VC_MODE8, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 8));
 
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA3,
+        rid_tab_data[3] =
             DRF_NUM(_INGRESS, _RIDTABDATA3, _PORT9,     NVSWITCH_PORTLIST_PORT_LR10(routing_id[i],  9)) |
             DRF_NUM(_INGRESS, _RIDTABDATA3, _VC_MODE9,  NVSWITCH_PORTLIST_VC_LR10(routing_id[i],  9))   |
             DRF_NUM(_INGRESS, _RIDTABDATA3, _PORT10,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 10)) |
             DRF_NUM(_INGRESS, _RIDTABDATA3, _VC_MODE10, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 10))   |
             DRF_NUM(_INGRESS, _RIDTABDATA3, _PORT11,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 11)) |
-            DRF_NUM(_INGRESS, _RIDTABDATA3, _VC_MODE11, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 11)));
+            DRF_NUM(_INGRESS, _RIDTABDATA3, _VC_MODE11, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 11));
 
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA4,
+        rid_tab_data[4] =
             DRF_NUM(_INGRESS, _RIDTABDATA4, _PORT12,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 12)) |
             DRF_NUM(_INGRESS, _RIDTABDATA4, _VC_MODE12, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 12))   |
             DRF_NUM(_INGRESS, _RIDTABDATA4, _PORT13,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 13)) |
             DRF_NUM(_INGRESS, _RIDTABDATA4, _VC_MODE13, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 13))   |
             DRF_NUM(_INGRESS, _RIDTABDATA4, _PORT14,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 14)) |
-            DRF_NUM(_INGRESS, _RIDTABDATA4, _VC_MODE14, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 14)));
+            DRF_NUM(_INGRESS, _RIDTABDATA4, _VC_MODE14, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 14));
 
         rmod =
             (routing_id[i].useRoutingLan ? NVBIT(6) : 0) |
             (routing_id[i].enableIrlErrResponse ? NVBIT(9) : 0);
 
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA5,
+        rid_tab_data[5] =
             DRF_NUM(_INGRESS, _RIDTABDATA5, _PORT15,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 15)) |
             DRF_NUM(_INGRESS, _RIDTABDATA5, _VC_MODE15, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 15))   |
             DRF_NUM(_INGRESS, _RIDTABDATA5, _RMOD,      rmod)                                           |
-            DRF_NUM(_INGRESS, _RIDTABDATA5, _ACLVALID,  routing_id[i].entryValid));
+            DRF_NUM(_INGRESS, _RIDTABDATA5, _ACLVALID,  routing_id[i].entryValid);
 
         NVSWITCH_ASSERT(routing_id[i].numEntries <= 16);
-        // Write last and auto-increment
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA0,
+        rid_tab_data[0] =
             DRF_NUM(_INGRESS, _RIDTABDATA0, _GSIZE,
                 (routing_id[i].numEntries == 16) ? 0x0 : routing_id[i].numEntries) |
             DRF_NUM(_INGRESS, _RIDTABDATA0, _PORT0,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 0)) |
@@ -2267,12 +2320,37 @@ _nvswitch_set_routing_id_lr10
             DRF_NUM(_INGRESS, _RIDTABDATA0, _PORT1,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 1)) |
             DRF_NUM(_INGRESS, _RIDTABDATA0, _VC_MODE1, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 1))   |
             DRF_NUM(_INGRESS, _RIDTABDATA0, _PORT2,    NVSWITCH_PORTLIST_PORT_LR10(routing_id[i], 2)) |
-            DRF_NUM(_INGRESS, _RIDTABDATA0, _VC_MODE2, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 2)));
+            DRF_NUM(_INGRESS, _RIDTABDATA0, _VC_MODE2, NVSWITCH_PORTLIST_VC_LR10(routing_id[i], 2));
+
+        // Skip entries hardware already holds; re-seek once the run breaks.
+        if (nvswitch_ingress_shadow_matches(shadow, firstIndex + i, rid_tab_data))
+        {
+            bSeek = NV_TRUE;
+            continue;
+        }
+
+        if (bSeek)
+        {
+            NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
+                DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, firstIndex + i) |
+                DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSRIDROUTERAM) |
+                DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+            bSeek = NV_FALSE;
+        }
+
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA1, rid_tab_data[1]);
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA2, rid_tab_data[2]);
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA3, rid_tab_data[3]);
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA4, rid_tab_data[4]);
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA5, rid_tab_data[5]);
+
+        // Write last and auto-increment
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RIDTABDATA0, rid_tab_data[0]);
+
+        nvswitch_ingress_shadow_update(shadow, firstIndex + i, rid_tab_data);
     }
 }
 
-#define NVSWITCH_NUM_RIDTABDATA_REGS_LR10 6
-
 NvlStatus
 nvswitch_ctrl_get_routing_id_lr10
 (
@@ -2287,6 +2365,8 @@ nvswitch_ctrl_get_routing_id_lr10
     NvU32 rmod;
     NvU32 gsize;
     NvU32 ram_size;
+    NVSWITCH_INGRESS_SHADOW *shadow;
+    NvBool bSeek = NV_TRUE;
 
     if (nvswitch_is_tnvl_mode_locked(device))
     {
@@ -2318,21 +2398,37 @@ nvswitch_ctrl_get_routing_id_lr10
     rid_entries = params->entries;
     rid_count = 0;
 
-    /* set table offset */
-    NVSWITCH_LINK_WR32_LR10(device, params->portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, params->firstIndex) |
-        DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSRIDROUTERAM) |
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+    shadow = nvswitch_ingress_shadow_get(device, NVSWITCH_INGRESS_SHADOW_RID,
+        params->portNum, ram_size, NVSWITCH_NUM_RIDTABDATA_REGS_LR10);
 
     while (rid_count < NVSWITCH_ROUTING_ID_ENTRIES_MAX &&
            table_index < ram_size)
     {
-        rid_tab_data[0] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA0);
-        rid_tab_data[1] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA1);
-        rid_tab_data[2] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA2);
-        rid_tab_data[3] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA3);
-        rid_tab_data[4] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA4);
-        rid_tab_data[5] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA5);
+        if (nvswitch_ingress_shadow_read(shadow, table_index, rid_tab_data))
+        {
+            bSeek = NV_TRUE;
+        }
+        else
+        {
+            if (bSeek)
+            {
+                /* set table offset */
+                NVSWITCH_LINK_WR32_LR10(device, params->portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
+                    DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, table_index) |
+                    DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSRIDROUTERAM) |
+                    DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+                bSeek = NV_FALSE;
+            }
+
+            rid_tab_data[0] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA0);
+            rid_tab_data[1] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA1);
+            rid_tab_data[2] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA2);
+            rid_tab_data[3] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA3);
+            rid_tab_data[4] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA4);
+            rid_tab_data[5] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RIDTABDATA5);
+
+            nvswitch_ingress_shadow_update(shadow, table_index, rid_tab_data);
+        }
 
         /* add to rid_entries list if nonzero */
         if (rid_tab_data[0] || rid_tab_data[1] || rid_tab_data[2] ||
@@ -2496,6 +2592,9 @@ nvswitch_ctrl_set_routing_id_valid_lr10
         NVSWITCH_LINK_WR32_LR10(device, p->portNum, NPORT, _INGRESS, _RIDTABDATA0, rid_tab_data0);
     }
 
+    nvswitch_ingress_shadow_invalidate(device->ingress_shadow[NVSWITCH_INGRESS_SHADOW_RID][p->portNum],
+        p->firstIndex, p->numEntries);
+
     // Allow traffic on the port
     retval = nvswitch_soe_issue_ingress_stop(device, p->portNum, NV_FALSE);
     if (retval != NVL_SUCCESS)
@@ -2616,6 +2715,8 @@ nvswitch_ctrl_set_routing_id_lr10
 #define NVSWITCH_PORTLIST_VALID_LR10(_entry, _idx, _field, _default) \
     ((_idx < _entry.numEntries) ? _entry.portList[_idx]._field  : _default)
 
+#define NVSWITCH_NUM_RLANTABDATA_REGS_LR10 6
+
 static void
 _nvswitch_set_routing_lan_lr10
 (
@@ -2627,11 +2728,13 @@ _nvswitch_set_routing_lan_lr10
 )
 {
     NvU32 i;
+    NvU32 rlan_tab_data[NVSWITCH_NUM_RLANTABDATA_REGS_LR10];
+    NVSWITCH_INGRESS_SHADOW *shadow;
+    NvBool bSeek = NV_TRUE;
 
-    NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, firstIndex) |
-        DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSRLANROUTERAM) |
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+    shadow = nvswitch_ingress_shadow_get(device, NVSWITCH_INGRESS_SHADOW_RLAN, portNum,
+        nvswitch_get_ingress_ram_size(device, NV_INGRESS_REQRSPMAPADDR_RAM_SEL_SELECTSRLANROUTERAM),
+        NVSWITCH_NUM_RLANTABDATA_REGS_LR10);
 
     for (i = 0; i < numEntries; i++)
     {
@@ -2643,51 +2746,77 @@ _nvswitch_set_routing_lan_lr10
         // See bug #3300673
         //
 
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA1,
+        rlan_tab_data[1] =
             DRF_NUM(_INGRESS, _RLANTABDATA1, _GRP_SEL_3, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 3, groupSelect, 0)) |
             DRF_NUM(_INGRESS, _RLANTABDATA1, _GRP_SIZE_3, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 3, groupSize, 1)) |
             DRF_NUM(_INGRESS, _RLANTABDATA1, _GRP_SEL_4, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 4, groupSelect, 0)) |
             DRF_NUM(_INGRESS, _RLANTABDATA1, _GRP_SIZE_4, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 4, groupSize, 1)) |
             DRF_NUM(_INGRESS, _RLANTABDATA1, _GRP_SEL_5, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 5, groupSelect, 0)) |
-            DRF_NUM(_INGRESS, _RLANTABDATA1, _GRP_SIZE_5, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 5, groupSize, 1)));
+            DRF_NUM(_INGRESS, _RLANTABDATA1, _GRP_SIZE_5, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 5, groupSize, 1));
 
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA2,
+        rlan_tab_data[2] =
             DRF_NUM(_INGRESS, _RLANTABDATA2, _GRP_SEL_6, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 6, groupSelect, 0)) |
             DRF_NUM(_INGRESS, _RLANTABDATA2, _GRP_SIZE_6, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 6, groupSize, 1)) |
             DRF_NUM(_INGRESS, _RLANTABDATA2, _GRP_SEL_7, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 7, groupSelect, 0)) |
             DRF_NUM(_INGRESS, _RLANTABDATA2, _GRP_SIZE_7, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 7, groupSize, 1)) |
             DRF_NUM(_INGRESS, _RLANTABDATA2, _GRP_SEL_8, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 8, groupSelect, 0)) |
-            DRF_NUM(_INGRESS, _RLANTABDATA2, _GRP_SIZE_8, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 8, groupSize, 1)));
+            DRF_NUM(_INGRESS, _RLANTABDATA2, _GRP_SIZE_8, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 8, groupSize, 1));
 
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA3,
+        rlan_tab_data[3] =
             DRF_NUM(_INGRESS, _RLANTABDATA3, _GRP_SEL_9, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 9, groupSelect, 0)) |
             DRF_NUM(_INGRESS, _RLANTABDATA3, _GRP_SIZE_9, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 9, groupSize, 1)) |
             DRF_NUM(_INGRESS, _RLANTABDATA3, _GRP_SEL_10, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 10, groupSelect, 0)) |
             DRF_NUM(_INGRESS, _RLANTABDATA3, _GRP_SIZE_10, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 10, groupSize, 1)) |
             DRF_NUM(_INGRESS, _RLANTABDATA3, _GRP_SEL_11, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 11, groupSelect, 0)) |
-            DRF_NUM(_INGRESS, _RLANTABDATA3, _GRP_SIZE_11, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 11, groupSize, 1)));
+            DRF_NUM(_INGRESS, _RLANTABDATA3, _GRP_SIZE_11, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 11, groupSize, 1));
 
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA4,
+        rlan_tab_data[4] =
             DRF_NUM(_INGRESS, _RLANTABDATA4, _GRP_SEL_12, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 12, groupSelect, 0)) |
             DRF_NUM(_INGRESS, _RLANTABDATA4, _GRP_SIZE_12, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 12, groupSize, 1)) |
             DRF_NUM(_INGRESS, _RLANTABDATA4, _GRP_SEL_13, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 13, groupSelect, 0)) |
             DRF_NUM(_INGRESS, _RLANTABDATA4, _GRP_SIZE_13, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 13, groupSize, 1)) |
             DRF_NUM(_INGRESS, _RLANTABDATA4, _GRP_SEL_14, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 14, groupSelect, 0)) |
-            DRF_NUM(_INGRESS, _RLANTABDATA4, _GRP_SIZE_14, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 14, groupSize, 1)));
+            DRF_NUM(_INGRESS, _RLANTABDATA4, _GRP_SIZE_14, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 14, groupSize, 1));
 
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA5,
+        rlan_tab_data[5] =
             DRF_NUM(_INGRESS, _RLANTABDATA5, _GRP_SEL_15, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 15, groupSelect, 0)) |
             DRF_NUM(_INGRESS, _RLANTABDATA5, _GRP_SIZE_15, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 15, groupSize, 1)) |
-            DRF_NUM(_INGRESS, _RLANTABDATA5, _ACLVALID,  routing_lan[i].entryValid));
+            DRF_NUM(_INGRESS, _RLANTABDATA5, _ACLVALID,  routing_lan[i].entryValid);
 
-        // Write last and auto-increment
-        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA0,
+        rlan_tab_data[0] =
             DRF_NUM(_INGRESS, _RLANTABDATA0, _GRP_SEL_0, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 0, groupSelect, 0)) |
             DRF_NUM(_INGRESS, _RLANTABDATA0, _GRP_SIZE_0, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 0, groupSize, 1)) |
             DRF_NUM(_INGRESS, _RLANTABDATA0, _GRP_SEL_1, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 1, groupSelect, 0)) |
             DRF_NUM(_INGRESS, _RLANTABDATA0, _GRP_SIZE_1, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 1, groupSize, 1)) |
             DRF_NUM(_INGRESS, _RLANTABDATA0, _GRP_SEL_2, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 2, groupSelect, 0)) |
-            DRF_NUM(_INGRESS, _RLANTABDATA0, _GRP_SIZE_2, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 2, groupSize, 1)));
+            DRF_NUM(_INGRESS, _RLANTABDATA0, _GRP_SIZE_2, NVSWITCH_PORTLIST_VALID_LR10(routing_lan[i], 2, groupSize, 1));
+
+        // Skip entries hardware already holds; re-seek once the run breaks.
+        if (nvswitch_ingress_shadow_matches(shadow, firstIndex + i, rlan_tab_data))
+        {
+            bSeek = NV_TRUE;
+            continue;
+        }
+
+        if (bSeek)
+        {
+            NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
+                DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, firstIndex + i) |
+                DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSRLANROUTERAM) |
+                DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+            bSeek = NV_FALSE;
+        }
+
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA1, rlan_tab_data[1]);
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA2, rlan_tab_data[2]);
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA3, rlan_tab_data[3]);
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA4, rlan_tab_data[4]);
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA5, rlan_tab_data[5]);
+
+        // Write last and auto-increment
+        NVSWITCH_LINK_WR32_LR10(device, portNum, NPORT, _INGRESS, _RLANTABDATA0, rlan_tab_data[0]);
+
+        nvswitch_ingress_shadow_update(shadow, firstIndex + i, rlan_tab_data);
     }
 }
 
@@ -2789,8 +2918,6 @@ nvswitch_ctrl_set_routing_lan_lr10
     return retval;
 }
 
-#define NVSWITCH_NUM_RLANTABDATA_REGS_LR10 6
-
 NvlStatus
 nvswitch_ctrl_get_routing_lan_lr10
 (
@@ -2803,6 +2930,8 @@ nvswitch_ctrl_get_routing_lan_lr10
     NvU32 rlan_tab_data[NVSWITCH_NUM_RLANTABDATA_REGS_LR10]; // 6 RLAN tables
     NvU32 rlan_count;
     NvU32 ram_size;
+    NVSWITCH_INGRESS_SHADOW *shadow;
+    NvBool bSeek = NV_TRUE;
 
     if (nvswitch_is_tnvl_mode_locked(device))
     {
@@ -2835,22 +2964,38 @@ nvswitch_ctrl_get_routing_lan_lr10
     rlan_entries = params->entries;
     rlan_count = 0;
 
-    /* set table offset */
-    NVSWITCH_LINK_WR32_LR10(device, params->portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, params->firstIndex) |
-        DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSRLANROUTERAM)   |
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+    shadow = nvswitch_ingress_shadow_get(device, NVSWITCH_INGRESS_SHADOW_RLAN,
+        params->portNum, ram_size, NVSWITCH_NUM_RLANTABDATA_REGS_LR10);
 
     while (rlan_count < NVSWITCH_ROUTING_LAN_ENTRIES_MAX &&
            table_index < ram_size)
     {
-        /* read one entry */
-        rlan_tab_data[0] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA0);
-        rlan_tab_data[1] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA1);
-        rlan_tab_data[2] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA2);
-        rlan_tab_data[3] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA3);
-        rlan_tab_data[4] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA4);
-        rlan_tab_data[5] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA5);
+        if (nvswitch_ingress_shadow_read(shadow, table_index, rlan_tab_data))
+        {
+            bSeek = NV_TRUE;
+        }
+        else
+        {
+            if (bSeek)
+            {
+                /* set table offset */
+                NVSWITCH_LINK_WR32_LR10(device, params->portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
+                    DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, table_index) |
+                    DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSRLANROUTERAM)   |
+                    DRF_NUM(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, 1));
+                bSeek = NV_FALSE;
+            }
+
+            /* read one entry */
+            rlan_tab_data[0] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA0);
+            rlan_tab_data[1] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA1);
+            rlan_tab_data[2] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA2);
+            rlan_tab_data[3] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA3);
+            rlan_tab_data[4] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA4);
+            rlan_tab_data[5] = NVSWITCH_LINK_RD32_LR10(device, params->portNum, NPORT, _INGRESS, _RLANTABDATA5);
+
+            nvswitch_ingress_shadow_update(shadow, table_index, rlan_tab_data);
+        }
 
         /* add to rlan_entries list if nonzero */
         if (rlan_tab_data[0] || rlan_tab_data[1] || rlan_tab_data[2] ||
@@ -2996,6 +3141,7 @@ nvswitch_ctrl_set_routing_lan_valid_lr10
     NvU32 ram_address = p->firstIndex;
     NvU32 i;
     NvU32 ram_size;
+    NVSWITCH_INGRESS_SHADOW *shadow;
     NvlStatus retval;
 
     if (nvswitch_is_tnvl_mode_locked(device))
@@ -3035,6 +3181,9 @@ nvswitch_ctrl_set_routing_lan_valid_lr10
         return retval;
     }
 
+    shadow = nvswitch_ingress_shadow_get(device, NVSWITCH_INGRESS_SHADOW_RLAN,
+        p->portNum, ram_size, NVSWITCH_NUM_RLANTABDATA_REGS_LR10);
+
     // Select RLAN RAM and disable Auto Increament.
     rlan_ctrl =
         DRF_DEF(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, _SELECTSRLANROUTERAM) |
@@ -3063,6 +3212,8 @@ nvswitch_ctrl_set_routing_lan_valid_lr10
         NVSWITCH_LINK_WR32_LR10(device, p->portNum, NPORT, _INGRESS, _RLANTABDATA4, rlan_tab_data[4]);
         NVSWITCH_LINK_WR32_LR10(device, p->portNum, NPORT, _INGRESS, _RLANTABDATA5, rlan_tab_data[5]);
         NVSWITCH_LINK_WR32_LR10(device, p->portNum, NPORT, _INGRESS, _RLANTABDATA0, rlan_tab_data[0]);
+
+        nvswitch_ingress_shadow_update(shadow, ram_address - 1, rlan_tab_data);
     }
 
     // Allow traffic on the port
@@ -6273,6 +6424,9 @@ nvswitch_reset_and_drain_links_lr10
         NVSWITCH_NPG_WR32_LR10(device, npg, _NPG, _WARMRESET,
             DRF_NUM(_NPG, _WARMRESET, _NPORTWARMRESET, ~NVBIT(idx_nport)));
 
+        // The warm reset clears this port's ingress routing RAMs.
+        nvswitch_ingress_shadow_invalidate_port(device, link);
+
         // Step 1.e : Initiate Minion reset sequence.
         status = nvswitch_request_tl_link_state_lr10(link_info,
             NV_NVLIPT_LNK_CTRL_LINK_STATE_REQUEST_REQUEST_RESET, NV_TRUE);
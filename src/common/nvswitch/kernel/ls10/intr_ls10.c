@@ -1678,6 +1678,8 @@ _nvswitch_service_ingress_fatal_ls10
         NVSWITCH_REPORT_CONTAIN_DATA(_HW_NPORT_INGRESS_EXTAREMAPTAB_ECC_DBE_ERR, data);
         nvswitch_clear_flags(&unhandled, bit);
 
+        nvswitch_ingress_shadow_invalidate_port(device, link);
+
         _nvswitch_construct_ecc_error_event_ls10(&err_event,
             NVSWITCH_ERR_HW_NPORT_INGRESS_EXTAREMAPTAB_ECC_DBE_ERR, link, NV_FALSE, 0,
             NV_TRUE, 1);
@@ -1754,6 +1756,8 @@ _nvswitch_service_ingress_fatal_ls10
         NVSWITCH_REPORT_CONTAIN_DATA(_HW_NPORT_INGRESS_REMAPTAB_ECC_DBE_ERR, data);
         nvswitch_clear_flags(&unhandled, bit);
 
+        nvswitch_ingress_shadow_invalidate_port(device, link);
+
         _nvswitch_construct_ecc_error_event_ls10(&err_event,
             NVSWITCH_ERR_HW_NPORT_INGRESS_REMAPTAB_ECC_DBE_ERR, link, bAddressValid,
             address, NV_TRUE, 1);
@@ -1784,6 +1788,8 @@ _nvswitch_service_ingress_fatal_ls10
         NVSWITCH_REPORT_CONTAIN_DATA(_HW_NPORT_INGRESS_RIDTAB_ECC_DBE_ERR, data);
         nvswitch_clear_flags(&unhandled, bit);
 
+        nvswitch_ingress_shadow_invalidate_port(device, link);
+
         _nvswitch_construct_ecc_error_event_ls10(&err_event,
             NVSWITCH_ERR_HW_NPORT_INGRESS_RIDTAB_ECC_DBE_ERR, link, bAddressValid,
             address, NV_TRUE, 1);
@@ -1814,6 +1820,8 @@ _nvswitch_service_ingress_fatal_ls10
         NVSWITCH_REPORT_CONTAIN_DATA(_HW_NPORT_INGRESS_RLANTAB_ECC_DBE_ERR, data);
         nvswitch_clear_flags(&unhandled, bit);
 
+        nvswitch_ingress_shadow_invalidate_port(device, link);
+
         _nvswitch_construct_ecc_error_event_ls10(&err_event,
             NVSWITCH_ERR_HW_NPORT_INGRESS_RLANTAB_ECC_DBE_ERR, link, bAddressValid,
             address, NV_TRUE, 1);
@@ -1845,6 +1853,8 @@ _nvswitch_service_ingress_fatal_ls10
         NVSWITCH_REPORT_CONTAIN_DATA(_HW_NPORT_INGRESS_EXTBREMAPTAB_ECC_DBE_ERR, data);
         nvswitch_clear_flags(&unhandled, bit);
 
+        nvswitch_ingress_shadow_invalidate_port(device, link);
+
         _nvswitch_construct_ecc_error_event_ls10(&err_event,
             NVSWITCH_ERR_HW_NPORT_INGRESS_EXTBREMAPTAB_ECC_DBE_ERR, link, NV_FALSE, 0,
             NV_TRUE, 1);
@@ -1637,6 +1637,9 @@ _nvswitch_reset_and_drain_links_ls10
         //
         nvswitch_soe_issue_nport_reset_ls10(device, link);
 
+        // Re-read routing RAMs from hardware after the port reset.
+        nvswitch_ingress_shadow_invalidate_port(device, link);
+
         //
         // Step 5.0 : Issue Minion request to perform the link reset sequence
         // We retry the Minion reset sequence 3 times, if we there is an error
@@ -3436,6 +3439,42 @@ nvswitch_get_ingress_ram_size_ls10
     return ram_size;
 }
 
+#define NVSWITCH_NUM_REMAP_POLICY_REGS_LS10 6
+
+//
+// Return the ingress shadow backing a unicast remap RAM.  The multicast remap
+// RAM is programmed through its own address register and is not shadowed.
+//
+static NVSWITCH_INGRESS_SHADOW *
+_nvswitch_get_remap_shadow_ls10
+(
+    nvswitch_device *device,
+    NvU32 portNum,
+    NvU32 remap_ram_sel
+)
+{
+    NVSWITCH_INGRESS_SHADOW_TABLE table;
+
+    switch (remap_ram_sel)
+    {
+        case NV_INGRESS_REQRSPMAPADDR_RAM_SEL_SELECTSNORMREMAPRAM:
+            table = NVSWITCH_INGRESS_SHADOW_REMAP;
+            break;
+        case NV_INGRESS_REQRSPMAPADDR_RAM_SEL_SELECTSEXTAREMAPRAM:
+            table = NVSWITCH_INGRESS_SHADOW_EXTA_REMAP;
+            break;
+        case NV_INGRESS_REQRSPMAPADDR_RAM_SEL_SELECTSEXTBREMAPRAM:
+            table = NVSWITCH_INGRESS_SHADOW_EXTB_REMAP;
+            break;
+        default:
+            return NULL;
+    }
+
+    return nvswitch_ingress_shadow_get(device, table, portNum,
+        nvswitch_get_ingress_ram_size(device, remap_ram_sel),
+        NVSWITCH_NUM_REMAP_POLICY_REGS_LS10);
+}
+
 static void
 _nvswitch_set_remap_policy_ls10
 (
@@ -3452,6 +3491,9 @@ _nvswitch_set_remap_policy_ls10
     NvU32 address_base;
     NvU32 address_limit;
     NvU32 rfunc;
+    NvU32 remap_policy_data[NVSWITCH_NUM_REMAP_POLICY_REGS_LS10];
+    NVSWITCH_INGRESS_SHADOW *shadow;
+    NvBool bSeek = NV_TRUE;
 
     if (nvswitch_is_tnvl_mode_locked(device))
     {
@@ -3460,10 +3502,7 @@ _nvswitch_set_remap_policy_ls10
         return;
     }
 
-    NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, firstIndex) |
-        DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, remap_ram_sel) |
-        DRF_DEF(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, _ENABLE));
+    shadow = _nvswitch_get_remap_shadow_ls10(device, portNum, remap_ram_sel);
 
     for (i = 0; i < numEntries; i++)
     {
@@ -3491,29 +3530,55 @@ _nvswitch_set_remap_policy_ls10
             rfunc |= NVBIT(5);
         }
 
-        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA1,
+        remap_policy_data[1] =
             DRF_NUM(_INGRESS, _REMAPTABDATA1, _REQCTXT_MSK, remap_policy[i].reqCtxMask) |
-            DRF_NUM(_INGRESS, _REMAPTABDATA1, _REQCTXT_CHK, remap_policy[i].reqCtxChk));
-        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA2,
-            DRF_NUM(_INGRESS, _REMAPTABDATA2, _REQCTXT_REP, remap_policy[i].reqCtxRep));
-        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA3,
+            DRF_NUM(_INGRESS, _REMAPTABDATA1, _REQCTXT_CHK, remap_policy[i].reqCtxChk);
+        remap_policy_data[2] =
+            DRF_NUM(_INGRESS, _REMAPTABDATA2, _REQCTXT_REP, remap_policy[i].reqCtxRep);
+        remap_policy_data[3] =
             DRF_NUM(_INGRESS, _REMAPTABDATA3, _ADR_BASE, address_base) |
-            DRF_NUM(_INGRESS, _REMAPTABDATA3, _ADR_LIMIT, address_limit));
-        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA4,
+            DRF_NUM(_INGRESS, _REMAPTABDATA3, _ADR_LIMIT, address_limit);
+        remap_policy_data[4] =
             DRF_NUM(_INGRESS, _REMAPTABDATA4, _TGTID, remap_policy[i].targetId) |
-            DRF_NUM(_INGRESS, _REMAPTABDATA4, _RFUNC, rfunc));
+            DRF_NUM(_INGRESS, _REMAPTABDATA4, _RFUNC, rfunc);
         // Get the upper bits of address_base/_limit
-        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA5,
+        remap_policy_data[5] =
             DRF_NUM(_INGRESS, _REMAPTABDATA5, _ADR_BASE,
                 (address_base >> DRF_SIZE(NV_INGRESS_REMAPTABDATA3_ADR_BASE))) |
             DRF_NUM(_INGRESS, _REMAPTABDATA5, _ADR_LIMIT,
-                (address_limit >> DRF_SIZE(NV_INGRESS_REMAPTABDATA3_ADR_LIMIT))));
+                (address_limit >> DRF_SIZE(NV_INGRESS_REMAPTABDATA3_ADR_LIMIT)));
 
-        // Write last and auto-increment
-        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA0,
+        remap_policy_data[0] =
             DRF_NUM(_INGRESS, _REMAPTABDATA0, _RMAP_ADDR, remap_address) |
             DRF_NUM(_INGRESS, _REMAPTABDATA0, _IRL_SEL, remap_policy[i].irlSelect) |
-            DRF_NUM(_INGRESS, _REMAPTABDATA0, _ACLVALID, remap_policy[i].entryValid));
+            DRF_NUM(_INGRESS, _REMAPTABDATA0, _ACLVALID, remap_policy[i].entryValid);
+
+        // Skip entries hardware already holds; re-seek once the run breaks.
+        if (nvswitch_ingress_shadow_matches(shadow, firstIndex + i, remap_policy_data))
+        {
+            bSeek = NV_TRUE;
+            continue;
+        }
+
+        if (bSeek)
+        {
+            NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
+                DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, firstIndex + i) |
+                DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, remap_ram_sel) |
+                DRF_DEF(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, _ENABLE));
+            bSeek = NV_FALSE;
+        }
+
+        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA1, remap_policy_data[1]);
+        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA2, remap_policy_data[2]);
+        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA3, remap_policy_data[3]);
+        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA4, remap_policy_data[4]);
+        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA5, remap_policy_data[5]);
+
+        // Write last and auto-increment
+        NVSWITCH_LINK_WR32_LS10(device, portNum, NPORT, _INGRESS, _REMAPTABDATA0, remap_policy_data[0]);
+
+        nvswitch_ingress_shadow_update(shadow, firstIndex + i, remap_policy_data);
     }
 }
 
@@ -3860,8 +3925,6 @@ nvswitch_ctrl_set_remap_policy_ls10
  * CTRL_NVSWITCH_GET_REMAP_POLICY
  */
 
-#define NVSWITCH_NUM_REMAP_POLICY_REGS_LS10 6
-
 NvlStatus
 nvswitch_ctrl_get_remap_policy_ls10
 (
@@ -3879,6 +3942,8 @@ nvswitch_ctrl_get_remap_policy_ls10
     NvU32 remap_ram_sel;
     NvU32 ram_size;
     NvlStatus retval;
+    NVSWITCH_INGRESS_SHADOW *shadow = NULL;
+    NvBool bSeek = NV_TRUE;
 
     if (nvswitch_is_tnvl_mode_locked(device))
     {
@@ -3936,10 +4001,7 @@ nvswitch_ctrl_get_remap_policy_ls10
     }
     else
     {
-        NVSWITCH_LINK_WR32_LS10(device, params->portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
-            DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, params->firstIndex) |
-            DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, remap_ram_sel) |
-            DRF_DEF(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, _ENABLE));
+        shadow = _nvswitch_get_remap_shadow_ls10(device, params->portNum, remap_ram_sel);
     }
 
     while (remap_count < NVSWITCH_REMAP_POLICY_ENTRIES_MAX &&
@@ -3954,14 +4016,29 @@ nvswitch_ctrl_get_remap_policy_ls10
             remap_policy_data[4] = NVSWITCH_LINK_RD32_LS10(device, params->portNum, NPORT, _INGRESS, _MCREMAPTABDATA4);
             remap_policy_data[5] = NVSWITCH_LINK_RD32_LS10(device, params->portNum, NPORT, _INGRESS, _MCREMAPTABDATA5);
         }
+        else if (nvswitch_ingress_shadow_read(shadow, table_index, remap_policy_data))
+        {
+            bSeek = NV_TRUE;
+        }
         else
         {
+            if (bSeek)
+            {
+                NVSWITCH_LINK_WR32_LS10(device, params->portNum, NPORT, _INGRESS, _REQRSPMAPADDR,
+                    DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_ADDRESS, table_index) |
+                    DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, remap_ram_sel) |
+                    DRF_DEF(_INGRESS, _REQRSPMAPADDR, _AUTO_INCR, _ENABLE));
+                bSeek = NV_FALSE;
+            }
+
             remap_policy_data[0] = NVSWITCH_LINK_RD32_LS10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA0);
             remap_policy_data[1] = NVSWITCH_LINK_RD32_LS10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA1);
             remap_policy_data[2] = NVSWITCH_LINK_RD32_LS10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA2);
             remap_policy_data[3] = NVSWITCH_LINK_RD32_LS10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA3);
             remap_policy_data[4] = NVSWITCH_LINK_RD32_LS10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA4);
             remap_policy_data[5] = NVSWITCH_LINK_RD32_LS10(device, params->portNum, NPORT, _INGRESS, _REMAPTABDATA5);
+
+            nvswitch_ingress_shadow_update(shadow, table_index, remap_policy_data);
         }
 
         /* add to remap_entries list if nonzero */
@@ -4063,6 +4140,7 @@ nvswitch_ctrl_set_remap_policy_valid_ls10
     NvU32 remap_ram_sel;
     NvU32 ram_size;
     NvlStatus retval;
+    NVSWITCH_INGRESS_SHADOW *shadow;
 
     if (nvswitch_is_tnvl_mode_locked(device))
     {
@@ -4145,6 +4223,8 @@ nvswitch_ctrl_set_remap_policy_valid_ls10
     }
     else
     {
+        shadow = _nvswitch_get_remap_shadow_ls10(device, p->portNum, remap_ram_sel);
+
         // Select REMAP POLICY RAM and disable Auto Increment.
         remap_ram =
             DRF_NUM(_INGRESS, _REQRSPMAPADDR, _RAM_SEL, remap_ram_sel) |
@@ -4172,6 +4252,8 @@ nvswitch_ctrl_set_remap_policy_valid_ls10
             NVSWITCH_LINK_WR32_LS10(device, p->portNum, NPORT, _INGRESS, _REMAPTABDATA2, remap_policy_data[2]);
             NVSWITCH_LINK_WR32_LS10(device, p->portNum, NPORT, _INGRESS, _REMAPTABDATA1, remap_policy_data[1]);
             NVSWITCH_LINK_WR32_LS10(device, p->portNum, NPORT, _INGRESS, _REMAPTABDATA0, remap_policy_data[0]);
+
+            nvswitch_ingress_shadow_update(shadow, ram_address - 1, remap_policy_data);
         }
     }
 
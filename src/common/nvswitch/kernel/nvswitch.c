@@ -2676,6 +2676,8 @@ nvswitch_lib_shutdown_device
 
     nvswitch_destroy_device_state(device);
 
+    nvswitch_ingress_shadow_destroy(device);
+
     _nvswitch_destroy_rom(device);
 
     _nvswitch_destruct_soe(device);
@@ -3656,7 +3658,21 @@ _nvswitch_ctrl_register_write
     NVSWITCH_REGISTER_WRITE *p
 )
 {
-    return device->hal.nvswitch_ctrl_register_write(device, p);
+    NvlStatus retval;
+    NvU32 port;
+
+    retval = device->hal.nvswitch_ctrl_register_write(device, p);
+
+    // A raw write may have reprogrammed a routing RAM behind the shadows.
+    if (retval == NVL_SUCCESS)
+    {
+        for (port = 0; port < NVSWITCH_MAX_LINK_COUNT; port++)
+        {
+            nvswitch_ingress_shadow_invalidate_port(device, port);
+        }
+    }
+
+    return retval;
 }
 
 NvU32
@@ -6178,6 +6194,9 @@ nvswitch_lib_ctrl_tnvl_lock_only
         NVSWITCH_DEV_CMD_DISPATCH(CTRL_NVSWITCH_GET_ERRORS,
                 nvswitch_ctrl_get_errors,
                 NVSWITCH_GET_ERRORS_PARAMS);
+        NVSWITCH_DEV_CMD_DISPATCH(CTRL_NVSWITCH_GET_ERROR_RECORDS,
+                nvswitch_ctrl_get_error_records,
+                NVSWITCH_GET_ERROR_RECORDS_PARAMS);
         NVSWITCH_DEV_CMD_DISPATCH(CTRL_NVSWITCH_GET_BIOS_INFO,
                 _nvswitch_ctrl_get_bios_info,
                 NVSWITCH_GET_BIOS_INFO_PARAMS);
@@ -6264,6 +6283,9 @@ nvswitch_lib_ctrl
         NVSWITCH_DEV_CMD_DISPATCH(CTRL_NVSWITCH_GET_ERRORS,
                 nvswitch_ctrl_get_errors,
                 NVSWITCH_GET_ERRORS_PARAMS);
+        NVSWITCH_DEV_CMD_DISPATCH(CTRL_NVSWITCH_GET_ERROR_RECORDS,
+                nvswitch_ctrl_get_error_records,
+                NVSWITCH_GET_ERROR_RECORDS_PARAMS);
         NVSWITCH_DEV_CMD_DISPATCH(CTRL_NVSWITCH_GET_PORT_EVENTS,
                 nvswitch_ctrl_get_port_events,
                 NVSWITCH_GET_PORT_EVENTS_PARAMS);        
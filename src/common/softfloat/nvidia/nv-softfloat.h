@@ -112,6 +112,59 @@ INLINE float32_t F32_AxB_plus_CxD_plus_E(
     return f32_add(tmpC, e);
 }
 
+/*
+ * Perform the following with float32_t: (a0 * b0) + (a1 * b1) + (a2 * b2)
+ *
+ * The sums are evaluated left to right, so this rounds identically to an
+ * accumulation loop, apart from the sign of an exactly zero result.
+ */
+INLINE float32_t F32_dot3(
+    float32_t a0, float32_t a1, float32_t a2,
+    float32_t b0, float32_t b1, float32_t b2)
+{
+    const float32_t tmpA = f32_mul(a0, b0);
+    const float32_t tmpB = f32_mul(a1, b1);
+    const float32_t tmpC = f32_mul(a2, b2);
+
+    return f32_add(f32_add(tmpA, tmpB), tmpC);
+}
+
+/*
+ * Multiply the row-major 3x3 matrices 'l' and 'r' with float32_t, storing the
+ * result in 'd'.  'd' must not alias 'l' or 'r'.
+ */
+INLINE void F32_mat3x3_mul(
+    float32_t d[3][3],
+    const float32_t l[3][3],
+    const float32_t r[3][3])
+{
+    int dx, dy;
+
+    for (dy = 0; dy < 3; dy++) {
+        for (dx = 0; dx < 3; dx++) {
+            d[dy][dx] = F32_dot3(l[dy][0], l[dy][1], l[dy][2],
+                                 r[0][dx], r[1][dx], r[2][dx]);
+        }
+    }
+}
+
+/*
+ * Transform the point (x, y, 1) by the row-major 3x3 matrix 'm' with
+ * float32_t, returning the homogeneous result in *pX, *pY and *pW.
+ */
+INLINE void F32_mat3x3_transform_point(
+    const float32_t m[3][3],
+    float32_t x,
+    float32_t y,
+    float32_t *pX,
+    float32_t *pY,
+    float32_t *pW)
+{
+    *pX = F32_AxB_plus_CxD_plus_E(x, m[0][0], y, m[0][1], m[0][2]);
+    *pY = F32_AxB_plus_CxD_plus_E(x, m[1][0], y, m[1][1], m[1][2]);
+    *pW = F32_AxB_plus_CxD_plus_E(x, m[2][0], y, m[2][1], m[2][2]);
+}
+
 /*
  * Perform the following with float32_t: (a * b) - (c * d)
  */
@@ -147,7 +147,7 @@ float32_t f32_div( float32_t a, float32_t b )
         }
     }
 #endif
-    return softfloat_roundPackToF32( signZ, expZ, sigZ );
+    return softfloat_roundPackToF32Fast( signZ, expZ, sigZ );
     /*------------------------------------------------------------------------
     *------------------------------------------------------------------------*/
  propagateNaN:
@@ -41,6 +41,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include "primitives.h"
 #include "softfloat_types.h"
+#include "softfloat.h"
 
 union ui16_f16 { uint16_t ui; float16_t f; };
 union ui32_f32 { uint32_t ui; float32_t f; };
@@ -97,6 +98,36 @@ struct exp16_sig32 softfloat_normSubnormalF32Sig( uint_fast32_t );
 float32_t softfloat_roundPackToF32( bool, int_fast16_t, uint_fast32_t );
 float32_t softfloat_normRoundPackToF32( bool, int_fast16_t, uint_fast32_t );
 
+/*----------------------------------------------------------------------------
+| Inline fast path for 'softfloat_roundPackToF32'.  When rounding to nearest
+| even and 'exp' is small enough that the rounded result is a normal number,
+| none of the overflow, underflow or rounding mode handling is needed; every
+| other case is passed on to the full routine.  The arguments and result are
+| exactly as for 'softfloat_roundPackToF32', so 'sig' must be normalized with
+| its most-significant bit at bit 30.
+*----------------------------------------------------------------------------*/
+INLINE
+float32_t
+ softfloat_roundPackToF32Fast( bool sign, int_fast16_t exp, uint_fast32_t sig )
+{
+    uint_fast8_t roundBits;
+    union ui32_f32 uZ;
+
+    if (
+        (0xFD <= (unsigned int) exp)
+            || (softfloat_roundingMode != softfloat_round_near_even)
+    ) {
+        return softfloat_roundPackToF32( sign, exp, sig );
+    }
+    roundBits = sig & 0x7F;
+    if ( roundBits ) softfloat_exceptionFlags |= softfloat_flag_inexact;
+    sig = (sig + 0x40)>>7;
+    if ( roundBits == 0x40 ) sig &= ~(uint_fast32_t) 1;
+    uZ.ui = packToF32UI( sign, exp, sig );
+    return uZ.f;
+
+}
+
 float32_t softfloat_addMagsF32( uint_fast32_t, uint_fast32_t );
 float32_t softfloat_subMagsF32( uint_fast32_t, uint_fast32_t );
 float32_t
@@ -51,7 +51,7 @@ float32_t
         uZ.ui = packToF32UI( sign, sig ? exp : 0, sig<<(shiftDist - 7) );
         return uZ.f;
     } else {
-        return softfloat_roundPackToF32( sign, exp, sig<<shiftDist );
+        return softfloat_roundPackToF32Fast( sign, exp, sig<<shiftDist );
     }
 
 }
@@ -36,6 +36,8 @@ void _nv3dSetVertexStreamEndFermi(
     Nv3dChannelPtr p3dChannel,
     enum Nv3dVertexAttributeStreamType stream,
     const Nv3dVertexAttributeStreamRec *pStream);
+void _nv3dReleaseProgramCodeFermi(
+    Nv3dDevicePtr p3dDevice);
 
 #endif /* __NVIDIA_3D_FERMI__ */
 
@@ -381,6 +381,12 @@ typedef struct _Nv3dDeviceRec {
 
     const Nv3dHal *hal;
 
+    /*
+     * Whether this device holds a reference on the shared decompressed
+     * shader program image for its shaderArch.
+     */
+    NvBool holdsProgramCode;
+
 } Nv3dDeviceRec, *Nv3dDevicePtr;
 
 typedef struct _Nv3dChannelProgramsRec {
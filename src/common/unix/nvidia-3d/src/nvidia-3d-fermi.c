@@ -92,18 +92,79 @@ fail:
     return NULL;
 }
 
-static void *DecompressPrograms(const Nv3dChannelRec *p3dChannel)
+/*
+ * Decompressed shader program images, one per shader architecture.
+ *
+ * Decompressing the xz blob dominates nv3dInitChannel(), and the result only
+ * depends on the shader architecture, so keep the image for as long as any
+ * Nv3dDeviceRec of that architecture exists.  Each Nv3dDeviceRec takes one
+ * reference the first time one of its channels is initialized, and drops it
+ * in nv3dFreeDevice(); the image is freed with the last reference.
+ *
+ * Like the rest of nvidia-3d, this relies on the host driver serializing
+ * device allocation and channel initialization.
+ */
+static struct {
+    void *code;
+    NvU32 refCount;
+} programCodeCache[NV3D_SHADER_ARCH_COUNT];
+
+static const void *AcquireProgramCode(const Nv3dChannelRec *p3dChannel)
 {
     const Nv3dChannelProgramsRec *pPrograms = &p3dChannel->programs;
-    const size_t compressedSize =
-        pPrograms->code.compressedEnd - pPrograms->code.compressedStart;
+    Nv3dDevicePtr p3dDevice = p3dChannel->p3dDevice;
+    const enum Nv3dShaderArch arch = p3dDevice->shaderArch;
+
+    nvAssert(arch < NV3D_SHADER_ARCH_COUNT);
 
-    nvAssert(pPrograms->code.compressedEnd > pPrograms->code.compressedStart);
+    if (p3dDevice->holdsProgramCode) {
+        nvAssert(programCodeCache[arch].code != NULL);
+        return programCodeCache[arch].code;
+    }
+
+    if (programCodeCache[arch].code == NULL) {
+        const size_t compressedSize =
+            pPrograms->code.compressedEnd - pPrograms->code.compressedStart;
+
+        nvAssert(pPrograms->code.compressedEnd >
+                 pPrograms->code.compressedStart);
+        nvAssert(programCodeCache[arch].refCount == 0);
+
+        programCodeCache[arch].code =
+            DecompressUsingXz(p3dChannel,
+                              pPrograms->code.compressedStart,
+                              compressedSize,
+                              pPrograms->code.decompressedSize);
+
+        if (programCodeCache[arch].code == NULL) {
+            return NULL;
+        }
+    }
 
-    return DecompressUsingXz(p3dChannel,
-                             pPrograms->code.compressedStart,
-                             compressedSize,
-                             pPrograms->code.decompressedSize);
+    programCodeCache[arch].refCount++;
+    p3dDevice->holdsProgramCode = TRUE;
+
+    return programCodeCache[arch].code;
+}
+
+void _nv3dReleaseProgramCodeFermi(Nv3dDevicePtr p3dDevice)
+{
+    const enum Nv3dShaderArch arch = p3dDevice->shaderArch;
+
+    if (!p3dDevice->holdsProgramCode) {
+        return;
+    }
+
+    nvAssert(programCodeCache[arch].refCount > 0);
+    nvAssert(programCodeCache[arch].code != NULL);
+
+    programCodeCache[arch].refCount--;
+    p3dDevice->holdsProgramCode = FALSE;
+
+    if (programCodeCache[arch].refCount == 0) {
+        nv3dImportFree(programCodeCache[arch].code);
+        programCodeCache[arch].code = NULL;
+    }
 }
 
 /*
@@ -159,7 +220,7 @@ NvBool nv3dInitChannel(Nv3dChannelPtr p3dChannel)
     const NvU64 tex0GpuAddress = nv3dGetTextureGpuAddress(p3dChannel, 0);
     NvU64 gpuAddress;
     NvU32 i;
-    void *programCode = DecompressPrograms(p3dChannel);
+    const void *programCode = AcquireProgramCode(p3dChannel);
 
     if (programCode == NULL) {
         return FALSE;
@@ -270,9 +331,6 @@ NvBool nv3dInitChannel(Nv3dChannelPtr p3dChannel)
                                p3dChannel->programs.code.decompressedSize);
     }
 
-    nv3dImportFree(programCode);
-    programCode = NULL;
-
     for (i = 0; i < p3dChannel->programs.constants.count; i++) {
         const Nv3dShaderConstBufInfo *pInfo =
             &p3dChannel->programs.constants.info[i];
@@ -464,9 +464,11 @@ fail:
 void nv3dFreeDevice(Nv3dDevicePtr p3dDevice)
 {
     /*
-     * So far, there is nothing to free: Nv3dDevicePtr only stores
-     * queried information.
+     * Other than the shared shader program image, Nv3dDevicePtr only
+     * stores queried information.
      */
+    _nv3dReleaseProgramCodeFermi(p3dDevice);
+
     NVMISC_MEMSET(p3dDevice, 0, sizeof(*p3dDevice));
 }
 
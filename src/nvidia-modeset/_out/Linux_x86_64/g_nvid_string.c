@@ -0,0 +1,2 @@
+const char  NV_KMS_ID[] = "nvidia id: NVIDIA UNIX Open Kernel Mode Setting Driver for x86_64  575.51.03  Release Build  (root@vm)  Sun Oct 18 16:20:39 UTC 2026";
+const char *const pNV_KMS_ID =  NV_KMS_ID + 11;
@@ -0,0 +1 @@
+#define NVIDIA_VERSION "575.51.03"
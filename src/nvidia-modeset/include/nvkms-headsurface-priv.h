@@ -177,6 +177,20 @@ typedef struct _NVHsChannelEvoRec {
         NvU32 handle;
         Nv3dChannelRec channel;
         Nv3dRenderTexInfo texInfo[NVKMS_HEADSURFACE_TEXINFO_NUM];
+
+        /*
+         * nvkms_get_usec() when the channel was allocated; cleared once
+         * the first frame has been rendered and its latency reported.
+         */
+        NvU64 allocTimeUsec;
+
+        /*
+         * The static warp mesh most recently loaded into the channel's
+         * constant buffer, so that reconfigurations which don't change it
+         * can skip reloading it.
+         */
+        NvHsStaticWarpMesh loadedStaticWarpMesh;
+        NvBool staticWarpMeshLoaded;
     } nv3d;
 
     struct {
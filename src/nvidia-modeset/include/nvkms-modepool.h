@@ -36,6 +36,11 @@ nvValidateModeIndex(NVDpyEvoPtr pDpyEvo,
                     const struct NvKmsValidateModeIndexRequest *pRequest,
                     struct NvKmsValidateModeIndexReply *pReply);
 void
+nvValidateModeIndices(NVDpyEvoPtr pDpyEvo,
+                      const struct NvKmsValidateModeIndicesRequest *pRequest,
+                      struct NvKmsValidateModeIndexReply *pReplies,
+                      struct NvKmsValidateModeIndicesReply *pReply);
+void
 nvValidateModeEvo(NVDpyEvoPtr pDpyEvo,
                   const struct NvKmsValidateModeRequest *pRequest,
                   struct NvKmsValidateModeReply *pReply);
@@ -274,6 +274,7 @@ enum NvKmsIoctlCommand {
     NVKMS_IOCTL_ACCEL_VBLANK_SEM_CONTROLS,
     NVKMS_IOCTL_VRR_SIGNAL_SEMAPHORE,
     NVKMS_IOCTL_FRAMEBUFFER_CONSOLE_DISABLED,
+    NVKMS_IOCTL_VALIDATE_MODE_INDICES,
 };
 
 
@@ -1739,6 +1740,54 @@ struct NvKmsValidateModeIndexParams {
 };
 
 
+/*!
+ * NVKMS_IOCTL_VALIDATE_MODE_INDICES: Validate a range of a dpy's
+ * candidate modes in one call.
+ *
+ * This behaves like NVKMS_IOCTL_VALIDATE_MODE_INDEX called for each of
+ * the mode indices [firstModeIndex, firstModeIndex + numModes), except
+ * that no infoString is produced.  The result for each mode index is
+ * written to the request::pReplies array, which must have room for
+ * request::numModes NvKmsValidateModeIndexReply structures.
+ *
+ * reply::numModes is the number of entries written to pReplies.  If the
+ * candidate mode list ended within the range, reply::end is TRUE and
+ * reply::numModes may be smaller than request::numModes; the entry with
+ * end==TRUE is not counted.
+ *
+ * request::numModes may be at most NVKMS_MAX_VALIDATE_MODE_INDICES;
+ * clients with longer mode lists should advance firstModeIndex by
+ * reply::numModes and call again until reply::end is TRUE.
+ */
+
+#define NVKMS_MAX_VALIDATE_MODE_INDICES 64
+
+struct NvKmsValidateModeIndicesRequest {
+    NvKmsDeviceHandle deviceHandle;
+    NvKmsDispHandle dispHandle;
+    NVDpyId dpyId;
+    struct NvKmsModeValidationParams modeValidation;
+    NvU32 firstModeIndex;
+    NvU32 numModes;
+
+    /*
+     * Pointer to an array of 'numModes' NvKmsValidateModeIndexReply.
+     * Use nvKmsPointerToNvU64() to assign pReplies.
+     */
+    NvU64 pReplies NV_ALIGN_BYTES(8);
+};
+
+struct NvKmsValidateModeIndicesReply {
+    NvU32 numModes;
+    NvBool end;
+};
+
+struct NvKmsValidateModeIndicesParams {
+    struct NvKmsValidateModeIndicesRequest request; /*! in */
+    struct NvKmsValidateModeIndicesReply reply;     /*! out */
+};
+
+
 /*!
  * NVKMS_IOCTL_VALIDATE_MODE: Validate an individual mode for the
  * specified dpy.
@@ -2151,6 +2151,110 @@ static void CreateParsedEdidFromNVT_TIMING(
     pParsedEdid->valid = TRUE;
 }
 
+/*
+ * Cache of recent NvTiming_ParseEDIDInfo() results, keyed by the EDID
+ * bytes.  Dpys are re-probed constantly on MST topologies and behind KVM
+ * switches, usually with an unchanged EDID, and parsing all the extension
+ * blocks is expensive.  Accesses are serialized by the nvkms lock.
+ */
+#define NVKMS_PARSED_EDID_CACHE_SIZE 4
+
+static struct {
+    struct {
+        NvU32 crc32;
+        NvU32 length;
+        NvU8 *pEdid;
+        NVT_EDID_INFO *pInfo;
+        NvU64 lastUse;
+    } entries[NVKMS_PARSED_EDID_CACHE_SIZE];
+
+    NvU64 useCount;
+    NvU32 hits;
+    NvU32 misses;
+} parsedEdidCache;
+
+void nvClearParsedEdidCache(void)
+{
+    int i;
+
+    for (i = 0; i < ARRAY_LEN(parsedEdidCache.entries); i++) {
+        nvFree(parsedEdidCache.entries[i].pEdid);
+        nvFree(parsedEdidCache.entries[i].pInfo);
+    }
+
+    nvkms_memset(&parsedEdidCache, 0, sizeof(parsedEdidCache));
+}
+
+static NVT_STATUS ParseEdidInfoCached(NvU8 *pEdidData, NvU32 length,
+                                      NVT_EDID_INFO *pInfo)
+{
+    const NvU32 crc32 = NvTiming_CalculateEDIDCRC32(pEdidData, length);
+    NVT_STATUS status;
+    int i, victim = 0;
+
+    parsedEdidCache.useCount++;
+
+    for (i = 0; i < ARRAY_LEN(parsedEdidCache.entries); i++) {
+        if ((parsedEdidCache.entries[i].pInfo != NULL) &&
+            (parsedEdidCache.entries[i].crc32 == crc32) &&
+            (parsedEdidCache.entries[i].length == length) &&
+            (nvkms_memcmp(parsedEdidCache.entries[i].pEdid,
+                          pEdidData, length) == 0)) {
+
+            nvkms_memcpy(pInfo, parsedEdidCache.entries[i].pInfo,
+                         sizeof(*pInfo));
+            parsedEdidCache.entries[i].lastUse = parsedEdidCache.useCount;
+            parsedEdidCache.hits++;
+
+            nvEvoLogDebug(EVO_LOG_INFO,
+                          "Parsed EDID cache hit (%u hits, %u misses)",
+                          parsedEdidCache.hits, parsedEdidCache.misses);
+            return NVT_STATUS_SUCCESS;
+        }
+
+        if (parsedEdidCache.entries[i].lastUse <
+            parsedEdidCache.entries[victim].lastUse) {
+            victim = i;
+        }
+    }
+
+    parsedEdidCache.misses++;
+
+    status = NvTiming_ParseEDIDInfo(pEdidData, length, pInfo);
+
+    if (status != NVT_STATUS_SUCCESS) {
+        return status;
+    }
+
+    /* Replace the least recently used entry; failing to cache is harmless. */
+
+    if (parsedEdidCache.entries[victim].pInfo == NULL) {
+        parsedEdidCache.entries[victim].pInfo =
+            nvAlloc(sizeof(*parsedEdidCache.entries[victim].pInfo));
+    }
+
+    nvFree(parsedEdidCache.entries[victim].pEdid);
+    parsedEdidCache.entries[victim].pEdid = nvAlloc(length);
+
+    if ((parsedEdidCache.entries[victim].pInfo == NULL) ||
+        (parsedEdidCache.entries[victim].pEdid == NULL)) {
+        nvFree(parsedEdidCache.entries[victim].pEdid);
+        nvFree(parsedEdidCache.entries[victim].pInfo);
+        parsedEdidCache.entries[victim].pEdid = NULL;
+        parsedEdidCache.entries[victim].pInfo = NULL;
+        parsedEdidCache.entries[victim].lastUse = 0;
+        return status;
+    }
+
+    nvkms_memcpy(parsedEdidCache.entries[victim].pEdid, pEdidData, length);
+    nvkms_memcpy(parsedEdidCache.entries[victim].pInfo, pInfo, sizeof(*pInfo));
+    parsedEdidCache.entries[victim].crc32 = crc32;
+    parsedEdidCache.entries[victim].length = length;
+    parsedEdidCache.entries[victim].lastUse = parsedEdidCache.useCount;
+
+    return status;
+}
+
 /*
  * PatchAndParseEdid() - use the nvtiming library to parse the EDID data.  The
  * EDID data provided in the 'pEdid' argument may be patched or modified.
@@ -2176,8 +2280,8 @@ static void PatchAndParseEdid(
 
     /* parse the majority of information from the EDID */
 
-    status = NvTiming_ParseEDIDInfo(pEdid->buffer, pEdid->length,
-                                    &pParsedEdid->info);
+    status = ParseEdidInfoCached(pEdid->buffer, pEdid->length,
+                                 &pParsedEdid->info);
 
     if (status != NVT_STATUS_SUCCESS) {
         return;
@@ -311,6 +311,8 @@ NvBool nvHs3dAllocChannel(NVHsChannelEvoPtr pHsChannel)
     const NvU32 dispSdMask = NVBIT(pHsChannel->pDispEvo->displayOwner);
     NvPushChannelPtr p = &pHsChannel->nvPush.channel;
 
+    pHsChannel->nv3d.allocTimeUsec = nvkms_get_usec();
+
     if (!AllocNvPushChannel(pHsChannel)) {
         goto fail;
     }
@@ -706,9 +708,18 @@ static void LoadStaticWarpMesh(
 
     ct_assert(sizeof(*swm) <= NV3D_CONSTANT_BUFFER_SIZE);
 
+    if (pHsChannel->nv3d.staticWarpMeshLoaded &&
+        (nvkms_memcmp(&pHsChannel->nv3d.loadedStaticWarpMesh, swm,
+                      sizeof(*swm)) == 0)) {
+        return;
+    }
+
     nv3dSelectCb(p3d, NVKMS_HEADSURFACE_CONSTANT_BUFFER_STATIC_WARP_MESH);
 
     nv3dLoadConstants(p3d, 0, sizeof(*swm), swm);
+
+    pHsChannel->nv3d.loadedStaticWarpMesh = *swm;
+    pHsChannel->nv3d.staticWarpMeshLoaded = TRUE;
 }
 
 /*!
@@ -2007,6 +2018,15 @@ NvBool nvHs3dRenderFrame(
 
     nvPushKickoff(p);
 
+    if (pHsChannel->nv3d.allocTimeUsec != 0) {
+        nvEvoLogDispDebug(pHsChannel->pDispEvo, EVO_LOG_INFO,
+                          "First headSurface frame on apiHead %u submitted "
+                          "%" NvU64_fmtu " usec after channel allocation",
+                          pHsChannel->apiHead,
+                          nvkms_get_usec() - pHsChannel->nv3d.allocTimeUsec);
+        pHsChannel->nv3d.allocTimeUsec = 0;
+    }
+
     return TRUE;
 }
 
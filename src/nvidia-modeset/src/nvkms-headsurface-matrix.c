@@ -34,19 +34,8 @@ static struct NvKmsMatrixF32 MultiplyMatrix(
     const struct NvKmsMatrixF32 *r)
 {
     struct NvKmsMatrixF32 d = { };
-    int dx, dy;
-
-    for (dy = 0; dy < 3; dy++) {
-        for (dx = 0; dx < 3; dx++) {
-            float32_t v = NvU32viewAsF32(NV_FLOAT_ZERO);
-            int o;
-            for (o = 0; o < 3; o++) {
-                const float32_t a = f32_mul(l->m[dy][o], r->m[o][dx]);
-                v = f32_add(v, a);
-            }
-            d.m[dy][dx] = v;
-        }
-    }
+
+    F32_mat3x3_mul(d.m, l->m, r->m);
 
     return d;
 }
@@ -139,20 +128,10 @@ static inline void TransformVertex(
     float32_t *pY,
     float32_t *pQ)
 {
-    const float32_t x_in = *pX;
-    const float32_t y_in = *pY;
     const float32_t oneF32 = NvU32viewAsF32(NV_FLOAT_ONE);
     float32_t w, oneOverW, x, y;
 
-    x = F32_AxB_plus_CxD_plus_E(x_in, mat->m[0][0],
-                                y_in, mat->m[0][1],
-                                      mat->m[0][2]);
-    y = F32_AxB_plus_CxD_plus_E(x_in, mat->m[1][0],
-                                y_in, mat->m[1][1],
-                                      mat->m[1][2]);
-    w = F32_AxB_plus_CxD_plus_E(x_in, mat->m[2][0],
-                                y_in, mat->m[2][1],
-                                      mat->m[2][2]);
+    F32_mat3x3_transform_point(mat->m, *pX, *pY, &x, &y, &w);
     oneOverW = f32_div(oneF32, w);
 
     x = f32_mul(x, oneOverW);
@@ -601,17 +580,10 @@ static NvBool AssignStaticWarpMesh(
 }
 
 /*!
- * Assign NVHsChannelConfig::transform and NVHsChannelConfig::staticWarpMesh,
- * based on the current viewports described in NVHsChannelConfig, and various
- * client-requested state in NvKmsSetModeHeadSurfaceParams.
- *
- * \param[in,out]  pChannelConfig  The headSurface channel config.
- * \param[in]      p               The NVKMS client headSurface parameters.
- *
- * \return TRUE if the NVHsChannelConfig fields could be successfully assigned.
- * Otherwise, FALSE.
+ * Compute NVHsChannelConfig::transform and NVHsChannelConfig::staticWarpMesh;
+ * see nvHsAssignTransformMatrix().
  */
-NvBool nvHsAssignTransformMatrix(
+static NvBool ComputeTransformMatrix(
     NVHsChannelConfig *pChannelConfig,
     const struct NvKmsSetModeHeadSurfaceParams *p)
 {
@@ -659,3 +631,113 @@ NvBool nvHsAssignTransformMatrix(
     return AssignStaticWarpMesh(pChannelConfig);
 }
 
+
+/*
+ * Cache of recently derived headSurface geometry.  The transform and static
+ * warp mesh only depend on the viewports and the client's rotation,
+ * reflection, pixelShift and transform requests, which rarely change across
+ * the modesets and flips that re-evaluate a headSurface config.  Entries hold
+ * no pointers, so the cache needs no teardown.  Accesses are serialized by
+ * the nvkms lock.
+ */
+#define NVKMS_HS_TRANSFORM_CACHE_SIZE 4
+
+typedef struct {
+    NVHsConfigState state;
+    struct NvKmsRect viewPortIn;
+    struct NvKmsRect viewPortOut;
+    NvBool transformSpecified;
+    NvBool reflectionX;
+    NvBool reflectionY;
+    enum NvKmsRotation rotation;
+    enum NvKmsPixelShiftMode pixelShift;
+    struct NvKmsMatrix transform;
+} NVHsTransformCacheKey;
+
+static struct {
+    struct {
+        NVHsTransformCacheKey key;
+        struct NvKmsMatrixF32 transform;
+        NvHsStaticWarpMesh staticWarpMesh;
+        NvBool result;
+        NvU64 lastUse;
+    } entries[NVKMS_HS_TRANSFORM_CACHE_SIZE];
+
+    NvU64 useCount;
+} hsTransformCache;
+
+static void AssignTransformCacheKey(
+    NVHsTransformCacheKey *pKey,
+    const NVHsChannelConfig *pChannelConfig,
+    const struct NvKmsSetModeHeadSurfaceParams *p)
+{
+    /* Zero any padding, so that keys can be compared with memcmp. */
+    nvkms_memset(pKey, 0, sizeof(*pKey));
+
+    pKey->state = pChannelConfig->state;
+    pKey->viewPortIn = pChannelConfig->viewPortIn;
+    pKey->viewPortOut = pChannelConfig->viewPortOut;
+    pKey->transformSpecified = p->transformSpecified;
+    pKey->reflectionX = p->reflectionX;
+    pKey->reflectionY = p->reflectionY;
+    pKey->rotation = p->rotation;
+    pKey->pixelShift = p->pixelShift;
+
+    if (p->transformSpecified) {
+        pKey->transform = p->transform;
+    }
+}
+
+/*!
+ * Assign NVHsChannelConfig::transform and NVHsChannelConfig::staticWarpMesh,
+ * based on the current viewports described in NVHsChannelConfig, and various
+ * client-requested state in NvKmsSetModeHeadSurfaceParams.
+ *
+ * \param[in,out]  pChannelConfig  The headSurface channel config.
+ * \param[in]      p               The NVKMS client headSurface parameters.
+ *
+ * \return TRUE if the NVHsChannelConfig fields could be successfully assigned.
+ * Otherwise, FALSE.
+ */
+NvBool nvHsAssignTransformMatrix(
+    NVHsChannelConfig *pChannelConfig,
+    const struct NvKmsSetModeHeadSurfaceParams *p)
+{
+    NVHsTransformCacheKey key;
+    NvBool result;
+    int i, victim = 0;
+
+    AssignTransformCacheKey(&key, pChannelConfig, p);
+
+    hsTransformCache.useCount++;
+
+    for (i = 0; i < ARRAY_LEN(hsTransformCache.entries); i++) {
+        if ((hsTransformCache.entries[i].lastUse != 0) &&
+            (nvkms_memcmp(&hsTransformCache.entries[i].key, &key,
+                          sizeof(key)) == 0)) {
+
+            pChannelConfig->transform = hsTransformCache.entries[i].transform;
+            pChannelConfig->staticWarpMesh =
+                hsTransformCache.entries[i].staticWarpMesh;
+            hsTransformCache.entries[i].lastUse = hsTransformCache.useCount;
+
+            return hsTransformCache.entries[i].result;
+        }
+
+        if (hsTransformCache.entries[i].lastUse <
+            hsTransformCache.entries[victim].lastUse) {
+            victim = i;
+        }
+    }
+
+    result = ComputeTransformMatrix(pChannelConfig, p);
+
+    hsTransformCache.entries[victim].key = key;
+    hsTransformCache.entries[victim].transform = pChannelConfig->transform;
+    hsTransformCache.entries[victim].staticWarpMesh =
+        pChannelConfig->staticWarpMesh;
+    hsTransformCache.entries[victim].result = result;
+    hsTransformCache.entries[victim].lastUse = hsTransformCache.useCount;
+
+    return result;
+}
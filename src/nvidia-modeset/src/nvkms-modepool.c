@@ -92,38 +92,52 @@ static NvBool ValidateMode(NVDpyEvoPtr pDpyEvo,
     (NV_MAX_RANGE_ELEMENT_STRING_LEN * NVKMS_MAX_VALID_SYNC_RANGES)
 
 
+/*!
+ * Validate the candidate mode at 'requestedModeIndex', logging to
+ * pInfoString.  Returns FALSE if the index is past the end of the
+ * candidate mode list.
+ */
+static NvBool
+ValidateOneModeIndex(NVDpyEvoPtr pDpyEvo,
+                     const struct NvKmsModeValidationParams *pParams,
+                     const NvU32 requestedModeIndex,
+                     struct NvKmsValidateModeIndexReply *pReply,
+                     NVEvoInfoStringPtr pInfoString)
+{
+    NvU32 currentModeIndex = 0;
+
+    nvkms_memset(pReply, 0, sizeof(*pReply));
+
+    if (ValidateModeIndexEdid(pDpyEvo, pParams, pReply, pInfoString,
+                              requestedModeIndex, &currentModeIndex)) {
+        return TRUE;
+    }
+
+    if (ValidateModeIndexVesa(pDpyEvo, pParams, pReply, pInfoString,
+                              requestedModeIndex, &currentModeIndex)) {
+        return TRUE;
+    }
+
+    pReply->end = 1;
+    return FALSE;
+}
+
 void
 nvValidateModeIndex(NVDpyEvoPtr pDpyEvo,
                     const struct NvKmsValidateModeIndexRequest *pRequest,
                     struct NvKmsValidateModeIndexReply *pReply)
 {
     const struct NvKmsModeValidationParams *pParams = &pRequest->modeValidation;
-    const NvU32 requestedModeIndex = pRequest->modeIndex;
     NVEvoInfoStringRec infoString;
-    NvU32 currentModeIndex = 0;
-    NvBool done;
-
-    nvkms_memset(pReply, 0, sizeof(*pReply));
 
     nvInitInfoString(&infoString, nvKmsNvU64ToPointer(pRequest->pInfoString),
                      pRequest->infoStringSize);
 
-    done = ValidateModeIndexEdid(pDpyEvo, pParams, pReply, &infoString,
-                                 requestedModeIndex, &currentModeIndex);
-    if (done) {
-        goto out;
-    }
-
-    done = ValidateModeIndexVesa(pDpyEvo, pParams, pReply, &infoString,
-                                 requestedModeIndex, &currentModeIndex);
-    if (done) {
-        goto out;
+    if (!ValidateOneModeIndex(pDpyEvo, pParams, pRequest->modeIndex,
+                              pReply, &infoString)) {
+        return;
     }
 
-    pReply->end = 1;
-    return;
-
-out:
     if (pRequest->infoStringSize > 0) {
         /* Add 1 for the final '\0' */
         nvAssert((infoString.length + 1) <= pRequest->infoStringSize);
@@ -132,6 +146,46 @@ out:
 }
 
 
+/*!
+ * Validate a range of candidate mode indices in one call, stopping at
+ * the end of the candidate mode list.
+ */
+void
+nvValidateModeIndices(NVDpyEvoPtr pDpyEvo,
+                      const struct NvKmsValidateModeIndicesRequest *pRequest,
+                      struct NvKmsValidateModeIndexReply *pReplies,
+                      struct NvKmsValidateModeIndicesReply *pReply)
+{
+    const struct NvKmsModeValidationParams *pParams = &pRequest->modeValidation;
+    NVEvoInfoStringRec infoString;
+    NvU32 i;
+#if defined(DEBUG)
+    const NvU64 startTime = nvkms_get_usec();
+#endif
+
+    nvkms_memset(pReply, 0, sizeof(*pReply));
+
+    nvInitInfoString(&infoString, NULL, 0);
+
+    for (i = 0; i < pRequest->numModes; i++) {
+        if (!ValidateOneModeIndex(pDpyEvo, pParams,
+                                  pRequest->firstModeIndex + i,
+                                  &pReplies[i], &infoString)) {
+            pReply->end = TRUE;
+            break;
+        }
+    }
+
+    pReply->numModes = i;
+
+#if defined(DEBUG)
+    nvEvoLogDebug(EVO_LOG_INFO,
+                  "Validated %u modes for %s in %" NvU64_fmtu " usec",
+                  i, pDpyEvo->name, nvkms_get_usec() - startTime);
+#endif
+}
+
+
 void
 nvValidateModeEvo(NVDpyEvoPtr pDpyEvo,
                   const struct NvKmsValidateModeRequest *pRequest,
@@ -2015,6 +2015,109 @@ static NvBool ValidateModeIndex(struct NvKmsPerOpen *pOpen,
     return TRUE;
 }
 
+/* Store a copy of the user's pReplies pointer, so we can copy out to it when
+ * we're done. */
+struct NvKmsValidateModeIndicesExtraUserState
+{
+    NvU64 userReplies;
+};
+
+/*
+ * Allocate a kernel buffer for the replies array, which will be copied out
+ * to userspace upon completion.
+ */
+static NvBool ValidateModeIndicesPrepUser(
+    void *pParamsVoid,
+    void *pExtraUserStateVoid)
+{
+    struct NvKmsValidateModeIndicesParams *pParams = pParamsVoid;
+    struct NvKmsValidateModeIndicesExtraUserState *pExtra = pExtraUserStateVoid;
+    struct NvKmsValidateModeIndexReply *pKernelReplies;
+
+    if ((pParams->request.numModes == 0) ||
+        (pParams->request.numModes > NVKMS_MAX_VALIDATE_MODE_INDICES)) {
+        return FALSE;
+    }
+
+    if (!nvKmsNvU64AddressIsSafe(pParams->request.pReplies)) {
+        return FALSE;
+    }
+
+    pKernelReplies = nvCalloc(pParams->request.numModes,
+                              sizeof(*pKernelReplies));
+    if (pKernelReplies == NULL) {
+        return FALSE;
+    }
+
+    pExtra->userReplies = pParams->request.pReplies;
+    pParams->request.pReplies = nvKmsPointerToNvU64(pKernelReplies);
+
+    return TRUE;
+}
+
+/*
+ * Copy the replies out to userspace and free the kernel-internal buffer.
+ */
+static NvBool ValidateModeIndicesDoneUser(
+    void *pParamsVoid,
+    void *pExtraUserStateVoid)
+{
+    struct NvKmsValidateModeIndicesParams *pParams = pParamsVoid;
+    struct NvKmsValidateModeIndicesExtraUserState *pExtra = pExtraUserStateVoid;
+    struct NvKmsValidateModeIndexReply *pKernelReplies =
+        nvKmsNvU64ToPointer(pParams->request.pReplies);
+    NvBool ret = TRUE;
+
+    if (pParams->reply.numModes > 0) {
+        int status;
+
+        nvAssert(pParams->reply.numModes <= pParams->request.numModes);
+
+        status = nvkms_copyout(pExtra->userReplies,
+                               pKernelReplies,
+                               sizeof(*pKernelReplies) *
+                               pParams->reply.numModes);
+        if (status != 0) {
+            ret = FALSE;
+        }
+    }
+
+    nvFree(pKernelReplies);
+
+    return ret;
+}
+
+/*!
+ * Validate a range of candidate modes.
+ */
+static NvBool ValidateModeIndices(struct NvKmsPerOpen *pOpen,
+                                  void *pParamsVoid)
+{
+    struct NvKmsValidateModeIndicesParams *pParams = pParamsVoid;
+    struct NvKmsValidateModeIndexReply *pReplies =
+        nvKmsNvU64ToPointer(pParams->request.pReplies);
+    NVDpyEvoPtr pDpyEvo;
+
+    if ((pReplies == NULL) ||
+        (pParams->request.numModes == 0) ||
+        (pParams->request.numModes > NVKMS_MAX_VALIDATE_MODE_INDICES)) {
+        return FALSE;
+    }
+
+    pDpyEvo = GetPerOpenDpy(pOpen,
+                            pParams->request.deviceHandle,
+                            pParams->request.dispHandle,
+                            pParams->request.dpyId);
+    if (pDpyEvo == NULL) {
+        return FALSE;
+    }
+
+    nvValidateModeIndices(pDpyEvo, &pParams->request, pReplies,
+                          &pParams->reply);
+
+    return TRUE;
+}
+
 struct NvKmsValidateModeExtraUserState
 {
     struct InfoStringExtraUserStateCommon common;
@@ -5134,6 +5237,7 @@ NvBool nvKmsIoctl(
         ENTRY(NVKMS_IOCTL_ACCEL_VBLANK_SEM_CONTROLS, AccelVblankSemControls),
         ENTRY(NVKMS_IOCTL_VRR_SIGNAL_SEMAPHORE, VrrSignalSemaphore),
         ENTRY(NVKMS_IOCTL_FRAMEBUFFER_CONSOLE_DISABLED, FramebufferConsoleDisabled),
+        ENTRY_CUSTOM_USER(NVKMS_IOCTL_VALIDATE_MODE_INDICES, ValidateModeIndices),
     };
 
     struct NvKmsPerOpen *pOpen = pOpenVoid;
@@ -6177,6 +6281,7 @@ static void FreeGlobalState(void)
     }
 
     nvClearDpyOverrides();
+    nvClearParsedEdidCache();
 }
 
 /*
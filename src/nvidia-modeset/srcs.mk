@@ -94,6 +94,7 @@ SRCS += ../common/softfloat/source/ui32_to_f32.c
 SRCS += ../common/softfloat/source/ui32_to_f64.c
 SRCS += ../common/softfloat/source/ui64_to_f32.c
 SRCS += ../common/softfloat/source/ui64_to_f64.c
+SRCS += ../common/src/nvCrc32.c
 SRCS += ../common/src/nv_smg.c
 SRCS_CXX += ../common/displayport/src/dp_auxretry.cpp
 SRCS_CXX += ../common/displayport/src/dp_bitstream.cpp
@@ -0,0 +1,2 @@
+const char  NVRM_ID[] = "nvidia id: NVIDIA UNIX Open Kernel Module for x86_64  575.51.03  Release Build  (root@vm)  Sun Oct 18 16:19:57 UTC 2026";
+const char *const pNVRM_ID =  NVRM_ID + 11;
@@ -40,6 +40,7 @@ struct API_STATE
     NvU32       flags;
     NvBool      bSizeValid;
     const char *msgTag;
+    PORT_MEM_CACHE *pCache;            // cache the kernel param buffer came from, if any
 };
 typedef struct API_STATE RMAPI_PARAM_COPY;
 
@@ -83,6 +84,7 @@ typedef struct API_STATE RMAPI_PARAM_COPY;
         (paramCopy).ppKernelParams = (void **) &(pKernelParams);                                        \
         (paramCopy).pUserParams    = (theUserParams);                                                   \
         (paramCopy).flags          = RMAPI_PARAM_COPY_FLAGS_NONE;                                       \
+        (paramCopy).pCache         = NULL;                                                              \
         (paramCopy).bSizeValid     = portSafeMulU32((numElems), (sizeOfElem), &(paramCopy).paramsSize); \
     } while(0)
 
@@ -96,4 +98,11 @@ NV_STATUS rmapiParamsCopyIn(const char *msgTag, void *pKernelParams, NvP64 pUser
 // Init copy_param structure
 NV_STATUS rmapiParamsCopyInit(RMAPI_PARAM_COPY *, NvU32 hClass);
 
+//
+// Kernel buffers for large params are recycled through size-class caches
+// once enabled, instead of being allocated and freed on every call.
+//
+NV_STATUS rmapiParamsCacheInit(void);
+void rmapiParamsCacheDestroy(void);
+
 #endif // _PARAM_COPY_H_
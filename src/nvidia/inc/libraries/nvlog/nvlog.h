@@ -29,6 +29,7 @@ extern "C" {
 
 #include "nvtypes.h"
 #include "nvstatus.h"
+#include <stdarg.h>
 
 /******************* Common Debug & Trace Defines **************************\
 *                                                                           *
@@ -382,6 +383,38 @@ void nvlogDeregisterFlushCb(void (*pCb)(void*), void *pData);
 //
 void nvlogRunFlushCbs(void);
 
+/**
+ * @brief Enable binary logging of debug prints into per-CPU ring buffers
+ *
+ * While enabled, prints below LEVEL_ERROR are not formatted on the calling
+ * path. The format string pointer and raw arguments are recorded into a ring
+ * of the current CPU without taking any lock, and only decoded when the logs
+ * are dumped with @ref nvlogDumpToKernelLog.
+ *
+ * Binary logging stays enabled until @ref nvlogDestroy.
+ *
+ * @param[in] numRecords  Number of records per CPU, rounded up to a power of 2
+ *
+ * @return NV_OK on success
+ */
+NV_STATUS nvlogBinaryEnable(NvU32 numRecords);
+
+/**
+ * @brief Check whether binary logging has been enabled
+ */
+NvBool nvlogBinaryIsEnabled(void);
+
+/**
+ * @brief Record a debug print into the binary ring of the current CPU
+ *
+ * String arguments are copied into the record (truncated if needed); all
+ * other arguments are recorded by value.
+ *
+ * @return NV_TRUE if the print was recorded and need not be formatted
+ */
+NvBool nvlogBinaryVPrintf(const char *pFile, NvU32 line, const char *pFunction,
+                          NvU32 level, const char *pFormat, va_list args);
+
 #else
 
 #define NVLOG_INIT(pData)
@@ -391,6 +424,10 @@ void nvlogRunFlushCbs(void);
 #define nvlogDumpToKernelLogIfEnabled()
 #define nvlogDumpToKernelLog(bDumpUnchangedBuffersOnlyOnce)
 
+#define nvlogBinaryEnable(numRecords) NV_ERR_NOT_SUPPORTED
+#define nvlogBinaryIsEnabled() NV_FALSE
+#define nvlogBinaryVPrintf(pFile, line, pFunction, level, pFormat, args) NV_FALSE
+
 #endif
 
 #ifdef __cplusplus
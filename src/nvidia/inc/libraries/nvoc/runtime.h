@@ -46,6 +46,28 @@ void __nvoc_objDelete(Dynamic *pDynamic);
 
 NV_STATUS __nvoc_handleObjCreateMemAlloc(NvU32 createFlags, NvU32 allocSize, void **ppLocalPtr, void **ppThis);
 
+/*!
+ * @brief Backs allocations of the given class with a @ref PORT_MEM_CACHE.
+ *
+ * Caches are keyed by object size, so classes of identical size share one.
+ * Must be called before any object of the class is created concurrently,
+ * typically at RM initialization.
+ */
+NV_STATUS nvocObjCacheEnable(const NVOC_CLASS_INFO *pClassInfo);
+
+/*!
+ * @brief Destroys all object caches.
+ *
+ * Objects still alive that were allocated from a cache are freed normally by
+ * objDelete afterwards.
+ */
+void nvocObjCacheDisableAll(void);
+
+/*!
+ * @brief Returns the statistics of the cache backing the given class.
+ */
+NV_STATUS nvocObjCacheGetStats(const NVOC_CLASS_INFO *pClassInfo, PORT_MEM_CACHE_STATS *pStats);
+
 NV_STATUS __nvoc_objCreateDynamic(
         Dynamic               **pNewObject,
         Dynamic                *pParent,
@@ -902,6 +902,91 @@ void *portMemExMapIOSpace(NvU64 start, NvU64 byteSize);
 void portMemExUnmapIOSpace(void *addr, NvU64 byteSize);
 #define portMemExUnmapIOSpace_SUPPORTED (NVOS_IS_WINDOWS && !PORT_IS_MODS)
 
+/**
+ * @brief Opaque cache of fixed-size non-paged objects.
+ *
+ * A cache keeps freed objects of a single size in per-CPU magazines backed by
+ * a shared depot, so that allocation-heavy paths can recycle objects without
+ * going through the general purpose allocator every time.
+ *
+ * Every object handed out by the cache is a regular
+ * @ref portMemAllocNonPaged allocation of the cache's object size, so it is
+ * always legal to release a cached object with @ref portMemFree instead of
+ * @ref portMemExCacheFree; the object is then simply not recycled.
+ */
+typedef struct PORT_MEM_CACHE PORT_MEM_CACHE;
+
+/**
+ * @brief Statistics gathered by a @ref PORT_MEM_CACHE
+ */
+typedef struct PORT_MEM_CACHE_STATS
+{
+    /** @brief Allocations satisfied from a magazine or the depot */
+    NvU64 allocHits;
+    /** @brief Allocations that fell back to @ref portMemAllocNonPaged */
+    NvU64 allocMisses;
+    /** @brief Frees that were recycled into a magazine or the depot */
+    NvU64 freeCached;
+    /** @brief Frees that were returned to @ref portMemFree */
+    NvU64 freeReleased;
+} PORT_MEM_CACHE_STATS;
+
+#define portMemExCacheCreate_SUPPORTED        PORT_IS_MODULE_SUPPORTED(sync)
+#define portMemExCacheDestroy_SUPPORTED       PORT_IS_MODULE_SUPPORTED(sync)
+#define portMemExCacheAlloc_SUPPORTED         PORT_IS_MODULE_SUPPORTED(sync)
+#define portMemExCacheFree_SUPPORTED          PORT_IS_MODULE_SUPPORTED(sync)
+#define portMemExCacheGetObjectSize_SUPPORTED PORT_IS_MODULE_SUPPORTED(sync)
+#define portMemExCacheGetStats_SUPPORTED      PORT_IS_MODULE_SUPPORTED(sync)
+
+/**
+ * @brief Creates a cache of objects of the given size.
+ *
+ * @param objectSize - Size of every object allocated from the cache.
+ * @param depotSize  - Maximum number of objects kept in the shared depot in
+ *                     addition to the per-CPU magazines.
+ *
+ * @return NULL if creation failed.
+ *
+ * @pre Unix: Non-interrupt context
+ */
+NV_FORCERESULTCHECK PORT_MEM_CACHE *portMemExCacheCreate(NvLength objectSize, NvU32 depotSize);
+
+/**
+ * @brief Destroys a cache and frees all objects it still holds.
+ *
+ * Objects that are currently allocated from the cache stay valid and must be
+ * released with @ref portMemFree.
+ */
+void portMemExCacheDestroy(PORT_MEM_CACHE *pCache);
+
+/**
+ * @brief Allocates an object from the cache.
+ *
+ * The contents of the returned object are undefined.
+ *
+ * @return NULL if the allocation failed.
+ */
+NV_FORCERESULTCHECK void *portMemExCacheAlloc(PORT_MEM_CACHE *pCache);
+
+/**
+ * @brief Returns an object to the cache.
+ *
+ * @par Undefined:
+ * pMem must have been allocated from pCache, or with @ref portMemAllocNonPaged
+ * using exactly the cache's object size.
+ */
+void portMemExCacheFree(PORT_MEM_CACHE *pCache, void *pMem);
+
+/**
+ * @brief Returns the size of the objects managed by the cache.
+ */
+NvLength portMemExCacheGetObjectSize(const PORT_MEM_CACHE *pCache);
+
+/**
+ * @brief Returns a snapshot of the cache statistics.
+ */
+void portMemExCacheGetStats(const PORT_MEM_CACHE *pCache, PORT_MEM_CACHE_STATS *pStats);
+
 // @} End extended functions
 
 
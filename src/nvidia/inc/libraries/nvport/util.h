@@ -218,6 +218,22 @@ void portUtilExSpinNs(NvU32 nanoseconds);
  */
 void portUtilExDelayMs(NvU32 milliseconds);
 
+#define portUtilExGetCpuNumber_SUPPORTED (PORT_IS_KERNEL_BUILD && NVOS_IS_UNIX)
+#define portUtilExGetCpuCount_SUPPORTED  (PORT_IS_KERNEL_BUILD && NVOS_IS_UNIX)
+
+/**
+ * @brief Returns the index of the CPU the caller is currently running on.
+ *
+ * The caller may be migrated to a different CPU as soon as this returns, so
+ * the value should only be used as a hint (e.g. to pick a per-CPU cache).
+ */
+NvU32 portUtilExGetCpuNumber(void);
+
+/**
+ * @brief Returns the number of possible CPUs in the system.
+ */
+NvU32 portUtilExGetCpuCount(void);
+
 #if (NVCPU_IS_FAMILY_X86 || NVCPU_IS_PPC64LE || NVCPU_IS_PPC || NVCPU_IS_AARCH64) && !defined(NV_MODS)
 /**
  * @brief Gets the Time stamp counter.
@@ -529,6 +529,17 @@
 //     n: Size of main buffer, in kilobytes
 
 
+// Type DWORD
+// Enables binary logging of debug prints below LEVEL_ERROR. Instead of being
+// formatted and printed immediately, prints are recorded into lock-free
+// per-CPU ring buffers as a format string pointer plus raw arguments, and are
+// decoded when NvLog is dumped to the kernel log (e.g. with RMDumpNvLog).
+// Encoding:
+//   0 - (Default) Disabled
+//   n - Number of records kept per CPU, rounded up to a power of 2
+#define NV_REG_STR_RM_NVLOG_BINARY                  "RMNvLogBinary"
+#define NV_REG_STR_RM_NVLOG_BINARY_DISABLE          (0x00000000)
+
 // Type DWORD
 // This can be used for dumping NvLog buffers (in /var/log/vmkernel.log ), when
 // we hit critical XIDs e.g 31/79.
@@ -1981,6 +1992,16 @@
 //
 #define NV_REG_STR_RM_CLIENT_LIST_DEFERRED_FREE_LIMIT      "RMClientListDeferredFreeLimit"
 
+//
+// Type: DWORD (Boolean)
+//
+// 1 - Recycle the kernel buffers used to copy in large control and alloc
+//     parameters (embedded pointers included) through per-CPU size-class
+//     caches, instead of allocating and freeing them on every call.
+// 0 - (Default) Allocate a new kernel buffer for every call.
+//
+#define NV_REG_STR_RM_PARAM_COPY_CACHE                     "RMParamCopyCache"
+
 //
 // TYPE Dword
 // Determines whether or not to emulate VF MMU TLB Invalidation register range
@@ -700,6 +700,13 @@ sysInitRegistryOverrides_IMPL
         RMTRACE_ENABLE(data32);
     }
 
+    if ((osReadRegistryDword(pGpu,
+            NV_REG_STR_RM_NVLOG_BINARY, &data32) == NV_OK) &&
+        (data32 != NV_REG_STR_RM_NVLOG_BINARY_DISABLE))
+    {
+        NV_ASSERT_OK(nvlogBinaryEnable(data32));
+    }
+
     if (osReadRegistryDword(pGpu,
             NV_REG_STR_RM_CLIENT_DATA_VALIDATION, &data32) == NV_OK)
     {
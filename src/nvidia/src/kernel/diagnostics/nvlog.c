@@ -28,6 +28,7 @@
 #include "diagnostics/tracer.h"
 #include "tls/tls.h"
 #include "core/locks.h"
+#include "core/printf.h"
 
 //
 // Buffer push method declarations
@@ -92,6 +93,65 @@ ct_assert(NVLOG_MAX_FLUSH_CBS >= NV_MAX_DEVICES);
 
 static NvlogFlushCb nvlogFlushCbs[NVLOG_MAX_FLUSH_CBS];
 
+//
+// Binary logging
+//
+// Each CPU owns a ring of fixed size records. A writer reserves a slot by
+// atomically incrementing the head of its CPU's ring, fills it in, and then
+// publishes it by writing the slot's sequence number. Writers never take a
+// lock; readers skip slots whose sequence number does not match, i.e. records
+// that are still being written or have already been overwritten.
+//
+#define NVLOG_BINARY_MAX_ARGS       10
+#define NVLOG_BINARY_STRING_SIZE    64
+#define NVLOG_BINARY_MAX_RECORDS    0x10000
+#define NVLOG_BINARY_DECODE_SIZE    256
+
+typedef enum
+{
+    NVLOG_BINARY_ARG_NONE,
+    NVLOG_BINARY_ARG_U32,
+    NVLOG_BINARY_ARG_U64,
+    NVLOG_BINARY_ARG_PTR,
+    NVLOG_BINARY_ARG_STRING
+} NVLOG_BINARY_ARG;
+
+typedef struct
+{
+    /** pos + 1 of the ring slot once published, 0 while being written */
+    volatile NvU64  seq;
+    NvU64           timestamp;
+    const char     *pFormat;
+    const char     *pFile;
+    const char     *pFunction;
+    NvU32           line;
+    NvU32           level;
+    NvU32           numArgs;
+    NvU32           strUsed;
+    /** Raw arguments; string arguments hold an offset into str */
+    NvU64           args[NVLOG_BINARY_MAX_ARGS];
+    char            str[NVLOG_BINARY_STRING_SIZE];
+} NVLOG_BINARY_RECORD;
+
+typedef struct
+{
+    /** Total number of records ever reserved in this ring */
+    volatile NvU64       head;
+    /** Value of head when this ring was last dumped */
+    NvU64                lastDumpHead;
+    NVLOG_BINARY_RECORD *pRecords;
+} NVLOG_BINARY_RING;
+
+static struct
+{
+    NVLOG_BINARY_RING **ppRings;
+    NvU32               numRings;
+    NvU32               recordMask;
+} nvlogBinary;
+
+static void _nvlogBinaryDestroy(void);
+static void _nvlogBinaryDumpToKernelLog(NvBool bDumpUnchangedBuffersOnlyOnce);
+
 NV_STATUS
 nvlogInit(void *pData)
 {
@@ -134,6 +194,8 @@ nvlogDestroy(void)
         nvlogDeallocBuffer(i, NV_TRUE);
     }
 
+    _nvlogBinaryDestroy();
+
     if (NvLogLogger.mainLock != NULL)
     {
         portSyncSpinlockDestroy(NvLogLogger.mainLock);
@@ -734,6 +796,8 @@ void nvlogDumpToKernelLog(NvBool bDumpUnchangedBuffersOnlyOnce)
     NvU32 i;
     static NvU32 lastDumpPos[NVLOG_MAX_BUFFERS];
 
+    _nvlogBinaryDumpToKernelLog(bDumpUnchangedBuffersOnlyOnce);
+
     for (i = 0; i < NVLOG_MAX_BUFFERS; i++)
     {
         NVLOG_BUFFER *pBuf = NvLogLogger.pBuffers[i];
@@ -828,3 +892,416 @@ void nvlogRunFlushCbs(void)
             nvlogFlushCbs[i].pCb(nvlogFlushCbs[i].pData);
     portSyncRwLockReleaseRead(NvLogLogger.flushCbsLock);
 }
+
+NV_STATUS
+nvlogBinaryEnable
+(
+    NvU32 numRecords
+)
+{
+    NVLOG_BINARY_RING **ppRings;
+    NvU32               numRings = 1;
+    NvU32               i;
+
+    NV_ASSERT_OR_RETURN(numRecords > 0, NV_ERR_INVALID_ARGUMENT);
+    NV_ASSERT_OR_RETURN(nvlogBinary.ppRings == NULL, NV_ERR_IN_USE);
+
+    numRecords = nvNextPow2_U32(NV_MIN(numRecords, NVLOG_BINARY_MAX_RECORDS));
+
+#if PORT_IS_FUNC_SUPPORTED(portUtilExGetCpuCount)
+    numRings = NV_MAX(portUtilExGetCpuCount(), 1);
+#endif
+
+    ppRings = portMemAllocNonPaged(numRings * sizeof(*ppRings));
+    if (ppRings == NULL)
+        return NV_ERR_NO_MEMORY;
+    portMemSet(ppRings, 0, numRings * sizeof(*ppRings));
+
+    for (i = 0; i < numRings; i++)
+    {
+        NvU32 size = sizeof(NVLOG_BINARY_RING) + numRecords * sizeof(NVLOG_BINARY_RECORD);
+
+        ppRings[i] = portMemAllocNonPaged(size);
+        if (ppRings[i] == NULL)
+        {
+            while (i-- > 0)
+                portMemFree(ppRings[i]);
+            portMemFree(ppRings);
+            return NV_ERR_NO_MEMORY;
+        }
+        portMemSet(ppRings[i], 0, size);
+        ppRings[i]->pRecords = (NVLOG_BINARY_RECORD *)(ppRings[i] + 1);
+    }
+
+    nvlogBinary.numRings   = numRings;
+    nvlogBinary.recordMask = numRecords - 1;
+    portAtomicMemoryFenceStore();
+    nvlogBinary.ppRings    = ppRings;
+
+    NV_PRINTF(LEVEL_INFO, "binary logging enabled: %u CPUs, %u records each\n",
+              numRings, numRecords);
+
+    return NV_OK;
+}
+
+NvBool
+nvlogBinaryIsEnabled(void)
+{
+    return (nvlogBinary.ppRings != NULL);
+}
+
+static void
+_nvlogBinaryDestroy(void)
+{
+    NvU32 i;
+
+    if (nvlogBinary.ppRings == NULL)
+        return;
+
+    for (i = 0; i < nvlogBinary.numRings; i++)
+        portMemFree(nvlogBinary.ppRings[i]);
+
+    portMemFree(nvlogBinary.ppRings);
+    nvlogBinary.ppRings = NULL;
+}
+
+//
+// Parses a conversion specification, f pointing just past the '%'. Only the
+// subset of printf understood by nvDbgVsnprintf is recognized, so recording
+// and decoding consume arguments exactly as formatting would.
+//
+static const char *
+_nvlogBinaryParseSpec
+(
+    const char       *f,
+    NvU32            *pNumStars,
+    NVLOG_BINARY_ARG *pArgType
+)
+{
+    NvBool bLongLong = NV_FALSE;
+
+    *pNumStars = 0;
+    *pArgType  = NVLOG_BINARY_ARG_NONE;
+
+    if (*f == '%')
+        return f + 1;
+
+    while ((*f == '-') || (*f == '+') || (*f == ' ') || (*f == '0'))
+        f++;
+
+    if (*f == '*')
+    {
+        (*pNumStars)++;
+        f++;
+    }
+    while ((*f >= '0') && (*f <= '9'))
+        f++;
+
+    if (*f == '.')
+    {
+        f++;
+        if (*f == '*')
+        {
+            (*pNumStars)++;
+            f++;
+        }
+        while ((*f >= '0') && (*f <= '9'))
+            f++;
+    }
+
+    if (*f == 'l')
+    {
+        f++;
+        if (*f == 'l')
+        {
+            bLongLong = NV_TRUE;
+            f++;
+        }
+    }
+
+    switch (*f)
+    {
+        case 'c':
+        case 'u':
+        case 'd':
+        case 'x':
+        case 'X':
+            *pArgType = bLongLong ? NVLOG_BINARY_ARG_U64 : NVLOG_BINARY_ARG_U32;
+            break;
+        case 'p':
+            *pArgType = NVLOG_BINARY_ARG_PTR;
+            break;
+        case 's':
+            *pArgType = NVLOG_BINARY_ARG_STRING;
+            break;
+        case '\0':
+            return f;
+        default:
+            break;
+    }
+
+    return f + 1;
+}
+
+static NvU64
+_nvlogBinaryCopyString
+(
+    NVLOG_BINARY_RECORD *pRecord,
+    const char          *pStr
+)
+{
+    NvU32 offset = pRecord->strUsed;
+
+    if (pStr == NULL)
+        pStr = "(null)";
+
+    while ((pRecord->strUsed < NVLOG_BINARY_STRING_SIZE - 1) && (*pStr != '\0'))
+        pRecord->str[pRecord->strUsed++] = *pStr++;
+
+    if (pRecord->strUsed < NVLOG_BINARY_STRING_SIZE)
+        pRecord->str[pRecord->strUsed++] = '\0';
+
+    // Strings that did not fit at all point at the terminating NUL
+    return NV_MIN(offset, NVLOG_BINARY_STRING_SIZE - 1);
+}
+
+NvBool
+nvlogBinaryVPrintf
+(
+    const char *pFile,
+    NvU32       line,
+    const char *pFunction,
+    NvU32       level,
+    const char *pFormat,
+    va_list     args
+)
+{
+    NVLOG_BINARY_RING   *pRing;
+    NVLOG_BINARY_RECORD *pSlot;
+    NVLOG_BINARY_RECORD  record;
+    NVLOG_BINARY_ARG     argType;
+    const char          *f = pFormat;
+    NvU32                numStars;
+    NvU32                cpu = 0;
+    NvU64                pos;
+
+    if ((nvlogBinary.ppRings == NULL) || (level >= LEVEL_ERROR))
+        return NV_FALSE;
+
+    record.numArgs = 0;
+    record.strUsed = 0;
+    record.str[NVLOG_BINARY_STRING_SIZE - 1] = '\0';
+
+    while (*f != '\0')
+    {
+        if (*f++ != '%')
+            continue;
+
+        f = _nvlogBinaryParseSpec(f, &numStars, &argType);
+
+        // Too many arguments to record, let the caller format it instead.
+        if (record.numArgs + numStars + (argType != NVLOG_BINARY_ARG_NONE) > NVLOG_BINARY_MAX_ARGS)
+            return NV_FALSE;
+
+        while (numStars-- > 0)
+            record.args[record.numArgs++] = (NvU32)va_arg(args, int);
+
+        switch (argType)
+        {
+            case NVLOG_BINARY_ARG_U32:
+                record.args[record.numArgs++] = va_arg(args, NvU32);
+                break;
+            case NVLOG_BINARY_ARG_U64:
+                record.args[record.numArgs++] = va_arg(args, NvU64);
+                break;
+            case NVLOG_BINARY_ARG_PTR:
+                record.args[record.numArgs++] = (NvU64)(NvUPtr)va_arg(args, void *);
+                break;
+            case NVLOG_BINARY_ARG_STRING:
+                record.args[record.numArgs++] =
+                    _nvlogBinaryCopyString(&record, va_arg(args, const char *));
+                break;
+            default:
+                break;
+        }
+    }
+
+    record.seq       = 0;
+    record.timestamp = osGetCurrentTick();
+    record.pFormat   = pFormat;
+    record.pFile     = pFile;
+    record.pFunction = pFunction;
+    record.line      = line;
+    record.level     = level;
+
+#if PORT_IS_FUNC_SUPPORTED(portUtilExGetCpuNumber)
+    cpu = portUtilExGetCpuNumber();
+    if (cpu >= nvlogBinary.numRings)
+        cpu %= nvlogBinary.numRings;
+#endif
+
+    pRing = nvlogBinary.ppRings[cpu];
+    pos   = portAtomicExIncrementU64(&pRing->head) - 1;
+    pSlot = &pRing->pRecords[pos & nvlogBinary.recordMask];
+
+    pSlot->seq = 0;
+    portAtomicMemoryFenceStore();
+    portMemCopy(pSlot, sizeof(*pSlot), &record, sizeof(record));
+    portAtomicMemoryFenceStore();
+
+    //
+    // A writer preempted between reserving and publishing its slot may find
+    // that the ring has since wrapped back onto the same slot. Don't publish
+    // over the newer record; let the caller print this one as text instead.
+    //
+    // This narrows but does not close the race: if the newer writer copies
+    // its record while this one is still copying, it publishes a slot with
+    // mixed contents and a valid seq. The record fields are all bounded
+    // (pFormat is a static string, str is NUL terminated and string offsets
+    // are clamped on decode), so such a record decodes to garbage but never
+    // reads out of bounds.
+    //
+    if (pRing->head - pos > (NvU64)nvlogBinary.recordMask + 1)
+        return NV_FALSE;
+
+    pSlot->seq = pos + 1;
+
+    return NV_TRUE;
+}
+
+//
+// Formats a record one conversion at a time, feeding each recorded argument
+// to nvDbgSnprintf with the type it was recorded as.
+//
+static void
+_nvlogBinaryDecode
+(
+    const NVLOG_BINARY_RECORD *pRecord,
+    char                      *pDest,
+    NvU32                      destSize
+)
+{
+    const char      *f = pRecord->pFormat;
+    NVLOG_BINARY_ARG argType;
+    NvU32            numStars;
+    NvU32            argIdx = 0;
+    NvU32            len = 0;
+    char             spec[32];
+
+    while ((*f != '\0') && (len < destSize - 1))
+    {
+        const char *pSpecStart = f;
+        NvU32       specLen = 0;
+        NvU64       arg = 0;
+
+        if (*f != '%')
+        {
+            pDest[len++] = *f++;
+            continue;
+        }
+
+        f = _nvlogBinaryParseSpec(f + 1, &numStars, &argType);
+
+        if (argIdx + numStars + (argType != NVLOG_BINARY_ARG_NONE) > pRecord->numArgs)
+            break;
+
+        // Rebuild the specification with '*' replaced by the recorded value
+        for (; (pSpecStart < f) && (specLen < sizeof(spec) - 12); pSpecStart++)
+        {
+            if (*pSpecStart == '*')
+            {
+                specLen += nvDbgSnprintf(&spec[specLen], sizeof(spec) - specLen, "%d",
+                                         (int)pRecord->args[argIdx++]);
+            }
+            else
+            {
+                spec[specLen++] = *pSpecStart;
+            }
+        }
+        if (pSpecStart < f)
+            break;
+        spec[specLen] = '\0';
+
+        if (argType != NVLOG_BINARY_ARG_NONE)
+            arg = pRecord->args[argIdx++];
+
+        switch (argType)
+        {
+            case NVLOG_BINARY_ARG_U32:
+                len += nvDbgSnprintf(&pDest[len], destSize - len, spec, (NvU32)arg);
+                break;
+            case NVLOG_BINARY_ARG_U64:
+                len += nvDbgSnprintf(&pDest[len], destSize - len, spec, arg);
+                break;
+            case NVLOG_BINARY_ARG_PTR:
+                len += nvDbgSnprintf(&pDest[len], destSize - len, spec, (void *)(NvUPtr)arg);
+                break;
+            case NVLOG_BINARY_ARG_STRING:
+                len += nvDbgSnprintf(&pDest[len], destSize - len, spec,
+                                     &pRecord->str[NV_MIN(arg, NVLOG_BINARY_STRING_SIZE - 1)]);
+                break;
+            default:
+                len += nvDbgSnprintf(&pDest[len], destSize - len, spec);
+                break;
+        }
+    }
+
+    pDest[NV_MIN(len, destSize - 1)] = '\0';
+}
+
+static void
+_nvlogBinaryDumpToKernelLog
+(
+    NvBool bDumpUnchangedBuffersOnlyOnce
+)
+{
+    NVLOG_BINARY_RECORD record;
+    char                msg[NVLOG_BINARY_DECODE_SIZE];
+    NvU32               numRecords = nvlogBinary.recordMask + 1;
+    NvU32               i;
+
+    if (nvlogBinary.ppRings == NULL)
+        return;
+
+    for (i = 0; i < nvlogBinary.numRings; i++)
+    {
+        NVLOG_BINARY_RING *pRing = nvlogBinary.ppRings[i];
+        NvU64 head  = pRing->head;
+        NvU64 first = (head > numRecords) ? (head - numRecords) : 0;
+        NvU64 pos;
+
+        if (bDumpUnchangedBuffersOnlyOnce)
+            first = NV_MAX(first, pRing->lastDumpHead);
+
+        if (first == head)
+            continue;
+
+        portDbgPrintf("nvrm-nvlog-bin: cpu %u: records %llu..%llu, %llu overwritten\n",
+                      i, first, head - 1,
+                      (head > numRecords) ? (head - numRecords) : 0);
+
+        for (pos = first; pos < head; pos++)
+        {
+            NVLOG_BINARY_RECORD *pSlot = &pRing->pRecords[pos & nvlogBinary.recordMask];
+
+            if (pSlot->seq != pos + 1)
+                continue;
+
+            // Don't let the copy below read the record before its seq
+            portAtomicMemoryFenceLoad();
+
+            portMemCopy(&record, sizeof(record), pSlot, sizeof(*pSlot));
+            portAtomicMemoryFenceLoad();
+
+            // Overwritten while being copied
+            if (pSlot->seq != pos + 1)
+                continue;
+
+            _nvlogBinaryDecode(&record, msg, sizeof(msg));
+            portDbgPrintf("nvrm-nvlog-bin: cpu %u: %llu %s:%u %s", i,
+                          record.timestamp, record.pFunction, record.line, msg);
+        }
+
+        pRing->lastDumpHead = head;
+    }
+}
@@ -249,6 +249,25 @@ void nvDbg_vPrintf
 
     if (nvDbg_PrintMsg(filename, linenumber, function, debuglevel, printf_format, &force, &prefix))
     {
+        //
+        // With binary logging enabled, verbose prints are recorded raw and
+        // only formatted when the logs are dumped.
+        //
+        if (!force)
+        {
+            va_list arglistCpy;
+            NvBool  bRecorded;
+
+            // arglist is still needed if the print could not be recorded
+            va_copy(arglistCpy, arglist);
+            bRecorded = nvlogBinaryVPrintf(filename, linenumber, function, debuglevel,
+                                           printf_format, arglistCpy);
+            va_end(arglistCpy);
+
+            if (bRecorded)
+                return;
+        }
+
         portSyncSpinlockAcquire(_nv_dbg_lock);
         _nvDbgPrepareString(filename, linenumber, function, printf_format, prefix, arglist);
 #if PORT_IS_FUNC_SUPPORTED(portDbgExPrintfLevel)
@@ -28,6 +28,98 @@
 #include "rmapi/control.h"
 #include "os/os.h"
 
+//
+// Size classes for recycled kernel param buffers. Smaller params are cheap to
+// allocate, and larger ones are rare enough that caching them is not worth
+// the memory they would pin.
+//
+static const NvU32 rmapiParamsCacheSizes[] = { 0x1000, 0x4000, 0x10000 };
+#define RMAPI_PARAMS_CACHE_DEPOT_SIZE 16
+
+static PORT_MEM_CACHE *rmapiParamsCaches[NV_ARRAY_ELEMENTS(rmapiParamsCacheSizes)];
+
+NV_STATUS
+rmapiParamsCacheInit(void)
+{
+    NvU32 i;
+
+    for (i = 0; i < NV_ARRAY_ELEMENTS(rmapiParamsCacheSizes); i++)
+    {
+        PORT_MEM_CACHE *pCache;
+
+        if (rmapiParamsCaches[i] != NULL)
+            continue;
+
+        pCache = portMemExCacheCreate(rmapiParamsCacheSizes[i], RMAPI_PARAMS_CACHE_DEPOT_SIZE);
+        if (pCache == NULL)
+            return NV_ERR_NO_MEMORY;
+
+        portAtomicMemoryFenceStore();
+        rmapiParamsCaches[i] = pCache;
+    }
+
+    return NV_OK;
+}
+
+void
+rmapiParamsCacheDestroy(void)
+{
+    NvU32 i;
+
+    for (i = 0; i < NV_ARRAY_ELEMENTS(rmapiParamsCacheSizes); i++)
+    {
+        if (rmapiParamsCaches[i] != NULL)
+        {
+            portMemExCacheDestroy(rmapiParamsCaches[i]);
+            rmapiParamsCaches[i] = NULL;
+        }
+    }
+}
+
+static void *
+_rmapiParamsAlloc
+(
+    RMAPI_PARAM_COPY *pParamCopy
+)
+{
+    NvU32 i;
+
+    pParamCopy->pCache = NULL;
+
+    for (i = 0; i < NV_ARRAY_ELEMENTS(rmapiParamsCacheSizes); i++)
+    {
+        if (pParamCopy->paramsSize <= rmapiParamsCacheSizes[i])
+        {
+            // The smallest class is only used for params that nearly fill it
+            if ((i == 0) && (pParamCopy->paramsSize <= rmapiParamsCacheSizes[0] / 2))
+                break;
+
+            pParamCopy->pCache = rmapiParamsCaches[i];
+            break;
+        }
+    }
+
+    if (pParamCopy->pCache != NULL)
+        return portMemExCacheAlloc(pParamCopy->pCache);
+
+    return portMemAllocNonPaged(pParamCopy->paramsSize);
+}
+
+static void
+_rmapiParamsFree
+(
+    RMAPI_PARAM_COPY *pParamCopy,
+    void             *pKernelParams
+)
+{
+    if (pParamCopy->pCache != NULL)
+        portMemExCacheFree(pParamCopy->pCache, pKernelParams);
+    else
+        portMemFree(pKernelParams);
+
+    pParamCopy->pCache = NULL;
+}
+
 NV_STATUS rmapiParamsAcquire
 (
     RMAPI_PARAM_COPY  *pParamCopy,
@@ -39,6 +131,8 @@ NV_STATUS rmapiParamsAcquire
     NV_STATUS   rmStatus = NV_OK;
     OBJSYS     *pSys = SYS_GET_INSTANCE();
 
+    pParamCopy->pCache = NULL;
+
     // Error check parameters
     if (((pParamCopy->paramsSize != 0) && (pParamCopy->pUserParams == NvP64_NULL)) ||
         ((pParamCopy->paramsSize == 0) && (pParamCopy->pUserParams != NvP64_NULL)) ||
@@ -93,7 +187,7 @@ NV_STATUS rmapiParamsAcquire
         }
     }
 
-    pKernelParams = portMemAllocNonPaged(pParamCopy->paramsSize);
+    pKernelParams = _rmapiParamsAlloc(pParamCopy);
     if (pKernelParams == NULL)
     {
         rmStatus = NV_ERR_INSUFFICIENT_RESOURCES;
@@ -107,8 +201,12 @@ NV_STATUS rmapiParamsAcquire
     {
         if (pParamCopy->flags & RMAPI_PARAM_COPY_FLAGS_SKIP_COPYIN)
         {
-            if (pParamCopy->flags & RMAPI_PARAM_COPY_FLAGS_ZERO_BUFFER)
+            // Recycled buffers may still hold another caller's params
+            if ((pParamCopy->flags & RMAPI_PARAM_COPY_FLAGS_ZERO_BUFFER) ||
+                (pParamCopy->pCache != NULL))
+            {
                 portMemSet(pKernelParams, 0, pParamCopy->paramsSize);
+            }
         }
         else
         {
@@ -128,7 +226,7 @@ done:
     {
         if (pKernelParams != NULL)
         {
-            portMemFree(pKernelParams);
+            _rmapiParamsFree(pParamCopy, pKernelParams);
             pKernelParams = NULL;
         }
     }
@@ -178,7 +276,7 @@ NV_STATUS rmapiParamsRelease
         }
     }
 
-    portMemFree(*pParamCopy->ppKernelParams);
+    _rmapiParamsFree(pParamCopy, *pParamCopy->ppKernelParams);
 
 done:
     // no longer ok to use the ptr, even if it was a direct usage
@@ -37,6 +37,10 @@
 #include "gpu_mgr/gpu_mgr.h"
 #include "resource_desc.h"
 #include "ctrl/ctrl0000/ctrl0000system.h"
+#include "rmapi/client.h"
+#include "rmapi/event.h"
+#include "gpu/subdevice/subdevice.h"
+#include "mem_mgr/system_mem.h"
 
 typedef struct
 {
@@ -63,6 +67,8 @@ static void _rmapiInitInterface(RM_API *pRmApi, API_SECURITY_INFO *pDefaultSecur
                                 NvBool bApiLockInternal, NvBool bGpuLockInternal);
 static NV_STATUS _rmapiLockAlloc(void);
 static void _rmapiLockFree(void);
+static void _rmapiObjCacheInit(void);
+static void _rmapiParamsCacheInit(void);
 
 // from rmapi_stubs.c
 void rmapiInitStubInterface(RM_API *pRmApi);
@@ -104,6 +110,9 @@ rmapiInitialize
 
     serverSetClientHandleBase(&g_resServ, RS_CLIENT_HANDLE_BASE);
 
+    _rmapiObjCacheInit();
+    _rmapiParamsCacheInit();
+
     listInit(&g_clientListBehindGpusLock, g_resServ.pAllocator);
     listInit(&g_userInfoList, g_resServ.pAllocator);
     multimapInit(&g_osInfoList, g_resServ.pAllocator);
@@ -142,6 +151,8 @@ rmapiShutdown
 
     serverFreeDomain(&g_resServ, 0);
     serverDestruct(&g_resServ);
+    nvocObjCacheDisableAll();
+    rmapiParamsCacheDestroy();
     _rmapiLockFree();
 
     rmapiControlCacheFree();
@@ -149,6 +160,54 @@ rmapiShutdown
     g_bResServInit = NV_FALSE;
 }
 
+//
+// Classes that are created and destroyed in bulk by every client (e.g. during
+// CUDA context setup and process teardown) are backed by NVOC object caches.
+//
+static const NVOC_CLASS_INFO *const g_rmapiCachedClasses[] =
+{
+    classInfo(RmClient),
+    classInfo(Device),
+    classInfo(Subdevice),
+    classInfo(Event),
+    classInfo(SystemMemory),
+};
+
+static void
+_rmapiObjCacheInit(void)
+{
+    NvU32 i;
+
+    for (i = 0; i < NV_ARRAY_ELEMENTS(g_rmapiCachedClasses); i++)
+    {
+        NV_STATUS status = nvocObjCacheEnable(g_rmapiCachedClasses[i]);
+
+        // Not fatal, the class simply falls back to the generic allocator.
+        if (status != NV_OK)
+        {
+            NV_PRINTF(LEVEL_WARNING, "Failed to enable object cache for class %d: 0x%x\n",
+                      g_rmapiCachedClasses[i]->classId, status);
+        }
+    }
+}
+
+static void
+_rmapiParamsCacheInit(void)
+{
+    NvU32     data32 = 0;
+    NV_STATUS status;
+
+    if ((osReadRegistryDword(NULL, NV_REG_STR_RM_PARAM_COPY_CACHE, &data32) != NV_OK) || !data32)
+        return;
+
+    // Not fatal, param buffers simply keep coming from the heap.
+    status = rmapiParamsCacheInit();
+    if (status != NV_OK)
+    {
+        NV_PRINTF(LEVEL_WARNING, "Failed to enable param copy cache: 0x%x\n", status);
+    }
+}
+
 static void
 _rmapiInitInterface
 (
@@ -144,6 +144,103 @@ Object *objGetDirectParent_IMPL(Object *pObj)
     return pObj->pParent;
 }
 
+//
+// Object caches for frequently created classes, keyed by object size.
+//
+// Objects handed out by a PORT_MEM_CACHE are plain portMemAllocNonPaged()
+// allocations of the cached size, so the generated objCreate failure paths
+// may keep releasing them with portMemFree().
+//
+#define NVOC_OBJ_CACHE_MAX_ENTRIES  32
+#define NVOC_OBJ_CACHE_DEPOT_SIZE   256
+
+typedef struct
+{
+    NvU32           size;
+    PORT_MEM_CACHE *pCache;
+} NVOC_OBJ_CACHE_ENTRY;
+
+static struct
+{
+    NvU32                numEntries;
+    NVOC_OBJ_CACHE_ENTRY entries[NVOC_OBJ_CACHE_MAX_ENTRIES];
+} g_nvocObjCache;
+
+static PORT_MEM_CACHE *_nvocObjCacheFind(NvU32 size)
+{
+    NvU32 i;
+
+    for (i = 0; i < g_nvocObjCache.numEntries; i++)
+    {
+        if (g_nvocObjCache.entries[i].size == size)
+            return g_nvocObjCache.entries[i].pCache;
+    }
+
+    return NULL;
+}
+
+NV_STATUS nvocObjCacheEnable(const NVOC_CLASS_INFO *pClassInfo)
+{
+#if PORT_IS_FUNC_SUPPORTED(portMemExCacheCreate)
+    NVOC_OBJ_CACHE_ENTRY *pEntry;
+
+    if (pClassInfo == NULL || pClassInfo->size == 0)
+        return NV_ERR_INVALID_ARGUMENT;
+
+    if (_nvocObjCacheFind(pClassInfo->size) != NULL)
+        return NV_OK;
+
+    if (g_nvocObjCache.numEntries == NVOC_OBJ_CACHE_MAX_ENTRIES)
+        return NV_ERR_INSUFFICIENT_RESOURCES;
+
+    pEntry = &g_nvocObjCache.entries[g_nvocObjCache.numEntries];
+    pEntry->pCache = portMemExCacheCreate(pClassInfo->size, NVOC_OBJ_CACHE_DEPOT_SIZE);
+    if (pEntry->pCache == NULL)
+        return NV_ERR_NO_MEMORY;
+
+    pEntry->size = pClassInfo->size;
+    g_nvocObjCache.numEntries++;
+
+    return NV_OK;
+#else
+    return NV_ERR_NOT_SUPPORTED;
+#endif
+}
+
+void nvocObjCacheDisableAll(void)
+{
+#if PORT_IS_FUNC_SUPPORTED(portMemExCacheCreate)
+    NvU32 numEntries = g_nvocObjCache.numEntries;
+    NvU32 i;
+
+    g_nvocObjCache.numEntries = 0;
+    for (i = 0; i < numEntries; i++)
+    {
+        portMemExCacheDestroy(g_nvocObjCache.entries[i].pCache);
+        g_nvocObjCache.entries[i].pCache = NULL;
+    }
+#endif
+}
+
+NV_STATUS nvocObjCacheGetStats(const NVOC_CLASS_INFO *pClassInfo, PORT_MEM_CACHE_STATS *pStats)
+{
+#if PORT_IS_FUNC_SUPPORTED(portMemExCacheCreate)
+    PORT_MEM_CACHE *pCache;
+
+    if (pClassInfo == NULL || pStats == NULL)
+        return NV_ERR_INVALID_ARGUMENT;
+
+    pCache = _nvocObjCacheFind(pClassInfo->size);
+    if (pCache == NULL)
+        return NV_ERR_OBJECT_NOT_FOUND;
+
+    portMemExCacheGetStats(pCache, pStats);
+    return NV_OK;
+#else
+    return NV_ERR_NOT_SUPPORTED;
+#endif
+}
+
 NV_STATUS __nvoc_handleObjCreateMemAlloc(NvU32 createFlags, NvU32 allocSize, void **ppLocalPtr, void **ppThis)
 {
     if (allocSize == 0 || ppThis == NULL || ppLocalPtr == NULL)
@@ -155,7 +252,15 @@ NV_STATUS __nvoc_handleObjCreateMemAlloc(NvU32 createFlags, NvU32 allocSize, voi
     }
     else
     {
-        *ppLocalPtr = portMemAllocNonPaged(allocSize);
+#if PORT_IS_FUNC_SUPPORTED(portMemExCacheCreate)
+        PORT_MEM_CACHE *pCache = _nvocObjCacheFind(allocSize);
+
+        if (pCache != NULL)
+            *ppLocalPtr = portMemExCacheAlloc(pCache);
+        else
+#endif
+            *ppLocalPtr = portMemAllocNonPaged(allocSize);
+
         if (*ppLocalPtr == NULL)
             return NV_ERR_NO_MEMORY;
     }
@@ -163,6 +268,21 @@ NV_STATUS __nvoc_handleObjCreateMemAlloc(NvU32 createFlags, NvU32 allocSize, voi
     return NV_OK;
 }
 
+static void _nvocObjFreeMem(Dynamic *pDerivedObj)
+{
+#if PORT_IS_FUNC_SUPPORTED(portMemExCacheCreate)
+    PORT_MEM_CACHE *pCache = _nvocObjCacheFind(pDerivedObj->__nvoc_rtti->pClassDef->classInfo.size);
+
+    if (pCache != NULL)
+    {
+        portMemExCacheFree(pCache, pDerivedObj);
+        return;
+    }
+#endif
+
+    portMemFree(pDerivedObj);
+}
+
 //! Internal backing method for objDelete.
 void __nvoc_objDelete(Dynamic *pDynamic)
 {
@@ -201,7 +321,7 @@ void __nvoc_objDelete(Dynamic *pDynamic)
 
     pDerivedObj = __nvoc_fullyDerive(pDynamic);
     if (!(pObj->createFlags & NVOC_OBJ_CREATE_FLAGS_IN_PLACE_CONSTRUCT))
-        portMemFree(pDerivedObj);
+        _nvocObjFreeMem(pDerivedObj);
 }
 
 //! Fill out an object's RTTI pointers from a class definition.
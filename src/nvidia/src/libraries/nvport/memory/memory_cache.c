@@ -0,0 +1,313 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * @file
+ * @brief MEMORY module fixed-size object cache
+ *
+ * Freed objects are kept in small per-CPU magazines. When a magazine runs
+ * empty it is refilled from a shared depot, and when it overflows half of it
+ * is flushed back to the depot. Only when both are exhausted (or full) does
+ * the cache fall back to portMemAllocNonPaged()/portMemFree().
+ */
+
+#include "nvport/nvport.h"
+#include "nvmisc.h"
+
+#if PORT_IS_FUNC_SUPPORTED(portMemExCacheCreate)
+
+#define PORT_MEM_CACHE_MAGAZINE_SIZE 16
+
+typedef struct PORT_MEM_CACHE_MAGAZINE
+{
+    PORT_SPINLOCK        *pLock;
+    NvU32                 count;
+    void                 *pObjects[PORT_MEM_CACHE_MAGAZINE_SIZE];
+    PORT_MEM_CACHE_STATS  stats;
+} PORT_MEM_CACHE_MAGAZINE;
+
+struct PORT_MEM_CACHE
+{
+    NvLength                 objectSize;
+    NvU32                    numMagazines;
+    PORT_MEM_CACHE_MAGAZINE *pMagazines;
+
+    PORT_SPINLOCK           *pDepotLock;
+    NvU32                    depotSize;
+    NvU32                    depotCount;
+    void                   **pDepot;
+};
+
+static NvU32
+_portMemCacheGetNumCpus(void)
+{
+#if PORT_IS_FUNC_SUPPORTED(portUtilExGetCpuCount)
+    NvU32 numCpus = portUtilExGetCpuCount();
+    return (numCpus != 0) ? numCpus : 1;
+#else
+    return 1;
+#endif
+}
+
+static NV_INLINE PORT_MEM_CACHE_MAGAZINE *
+_portMemCacheGetMagazine
+(
+    PORT_MEM_CACHE *pCache
+)
+{
+#if PORT_IS_FUNC_SUPPORTED(portUtilExGetCpuNumber)
+    if (pCache->numMagazines > 1)
+        return &pCache->pMagazines[portUtilExGetCpuNumber() % pCache->numMagazines];
+#endif
+    return &pCache->pMagazines[0];
+}
+
+//
+// Moves up to half a magazine worth of objects from the depot into pMagazine.
+// Caller must hold the magazine lock.
+//
+static void
+_portMemCacheRefillMagazine
+(
+    PORT_MEM_CACHE          *pCache,
+    PORT_MEM_CACHE_MAGAZINE *pMagazine
+)
+{
+    NvU32 count;
+
+    portSyncSpinlockAcquire(pCache->pDepotLock);
+    count = NV_MIN(pCache->depotCount, PORT_MEM_CACHE_MAGAZINE_SIZE / 2);
+    while (count-- > 0)
+    {
+        pMagazine->pObjects[pMagazine->count++] = pCache->pDepot[--pCache->depotCount];
+    }
+    portSyncSpinlockRelease(pCache->pDepotLock);
+}
+
+//
+// Moves up to half a magazine worth of objects from pMagazine into the depot.
+// Caller must hold the magazine lock.
+//
+static void
+_portMemCacheFlushMagazine
+(
+    PORT_MEM_CACHE          *pCache,
+    PORT_MEM_CACHE_MAGAZINE *pMagazine
+)
+{
+    NvU32 count;
+
+    portSyncSpinlockAcquire(pCache->pDepotLock);
+    count = NV_MIN(pCache->depotSize - pCache->depotCount, PORT_MEM_CACHE_MAGAZINE_SIZE / 2);
+    while (count-- > 0)
+    {
+        pCache->pDepot[pCache->depotCount++] = pMagazine->pObjects[--pMagazine->count];
+    }
+    portSyncSpinlockRelease(pCache->pDepotLock);
+}
+
+PORT_MEM_CACHE *
+portMemExCacheCreate
+(
+    NvLength objectSize,
+    NvU32    depotSize
+)
+{
+    PORT_MEM_ALLOCATOR *pAlloc = portMemAllocatorGetGlobalNonPaged();
+    PORT_MEM_CACHE     *pCache;
+    NvU32               numMagazines = _portMemCacheGetNumCpus();
+    NvLength            size;
+    NvU32               i;
+
+    if (objectSize == 0)
+        return NULL;
+
+    size = sizeof(*pCache) +
+           numMagazines * sizeof(PORT_MEM_CACHE_MAGAZINE) +
+           depotSize * sizeof(void *);
+
+    pCache = portMemAllocNonPaged(size);
+    if (pCache == NULL)
+        return NULL;
+
+    portMemSet(pCache, 0, size);
+    pCache->objectSize   = objectSize;
+    pCache->numMagazines = numMagazines;
+    pCache->pMagazines   = (PORT_MEM_CACHE_MAGAZINE *)(pCache + 1);
+    pCache->depotSize    = depotSize;
+    pCache->pDepot       = (void **)(pCache->pMagazines + numMagazines);
+
+    pCache->pDepotLock = portSyncSpinlockCreate(pAlloc);
+    if (pCache->pDepotLock == NULL)
+        goto failed;
+
+    for (i = 0; i < numMagazines; i++)
+    {
+        pCache->pMagazines[i].pLock = portSyncSpinlockCreate(pAlloc);
+        if (pCache->pMagazines[i].pLock == NULL)
+            goto failed;
+    }
+
+    return pCache;
+
+failed:
+    portMemExCacheDestroy(pCache);
+    return NULL;
+}
+
+void
+portMemExCacheDestroy
+(
+    PORT_MEM_CACHE *pCache
+)
+{
+    NvU32 i;
+
+    if (pCache == NULL)
+        return;
+
+    for (i = 0; i < pCache->numMagazines; i++)
+    {
+        PORT_MEM_CACHE_MAGAZINE *pMagazine = &pCache->pMagazines[i];
+
+        while (pMagazine->count > 0)
+            portMemFree(pMagazine->pObjects[--pMagazine->count]);
+
+        if (pMagazine->pLock != NULL)
+            portSyncSpinlockDestroy(pMagazine->pLock);
+    }
+
+    while (pCache->depotCount > 0)
+        portMemFree(pCache->pDepot[--pCache->depotCount]);
+
+    if (pCache->pDepotLock != NULL)
+        portSyncSpinlockDestroy(pCache->pDepotLock);
+
+    portMemFree(pCache);
+}
+
+void *
+portMemExCacheAlloc
+(
+    PORT_MEM_CACHE *pCache
+)
+{
+    PORT_MEM_CACHE_MAGAZINE *pMagazine = _portMemCacheGetMagazine(pCache);
+    void                    *pMem      = NULL;
+
+    portSyncSpinlockAcquire(pMagazine->pLock);
+
+    if (pMagazine->count == 0)
+        _portMemCacheRefillMagazine(pCache, pMagazine);
+
+    if (pMagazine->count > 0)
+    {
+        pMem = pMagazine->pObjects[--pMagazine->count];
+        pMagazine->stats.allocHits++;
+    }
+    else
+    {
+        pMagazine->stats.allocMisses++;
+    }
+
+    portSyncSpinlockRelease(pMagazine->pLock);
+
+    if (pMem == NULL)
+        pMem = portMemAllocNonPaged(pCache->objectSize);
+
+    return pMem;
+}
+
+void
+portMemExCacheFree
+(
+    PORT_MEM_CACHE *pCache,
+    void           *pMem
+)
+{
+    PORT_MEM_CACHE_MAGAZINE *pMagazine;
+    NvBool                   bCached = NV_FALSE;
+
+    if (pMem == NULL)
+        return;
+
+    pMagazine = _portMemCacheGetMagazine(pCache);
+
+    portSyncSpinlockAcquire(pMagazine->pLock);
+
+    if (pMagazine->count == PORT_MEM_CACHE_MAGAZINE_SIZE)
+        _portMemCacheFlushMagazine(pCache, pMagazine);
+
+    if (pMagazine->count < PORT_MEM_CACHE_MAGAZINE_SIZE)
+    {
+        pMagazine->pObjects[pMagazine->count++] = pMem;
+        pMagazine->stats.freeCached++;
+        bCached = NV_TRUE;
+    }
+    else
+    {
+        pMagazine->stats.freeReleased++;
+    }
+
+    portSyncSpinlockRelease(pMagazine->pLock);
+
+    if (!bCached)
+        portMemFree(pMem);
+}
+
+NvLength
+portMemExCacheGetObjectSize
+(
+    const PORT_MEM_CACHE *pCache
+)
+{
+    return pCache->objectSize;
+}
+
+void
+portMemExCacheGetStats
+(
+    const PORT_MEM_CACHE *pCache,
+    PORT_MEM_CACHE_STATS *pStats
+)
+{
+    NvU32 i;
+
+    portMemSet(pStats, 0, sizeof(*pStats));
+
+    //
+    // The per-magazine counters are read without taking the magazine locks,
+    // so the snapshot may be slightly stale but is never torn on 64-bit CPUs.
+    //
+    for (i = 0; i < pCache->numMagazines; i++)
+    {
+        const PORT_MEM_CACHE_STATS *pMagStats = &pCache->pMagazines[i].stats;
+
+        pStats->allocHits    += pMagStats->allocHits;
+        pStats->allocMisses  += pMagStats->allocMisses;
+        pStats->freeCached   += pMagStats->freeCached;
+        pStats->freeReleased += pMagStats->freeReleased;
+    }
+}
+
+#endif // PORT_IS_FUNC_SUPPORTED(portMemExCacheCreate)
@@ -42,3 +42,12 @@ NvBool portUtilIsInterruptContext(void)
     return os_is_isr();
 }
 
+NvU32 portUtilExGetCpuNumber(void)
+{
+    return os_get_cpu_number();
+}
+
+NvU32 portUtilExGetCpuCount(void)
+{
+    return os_get_cpu_count();
+}
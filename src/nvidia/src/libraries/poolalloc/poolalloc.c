@@ -26,30 +26,27 @@
 #include "utils/nvprintf.h"
 #include "utils/nvassert.h"
 
-// Local function declarations.
-static NvU32 ntz_64 (NvU64 bits);
-static NvU32 countZeros(NvU64 bits);
+//
+// Bits at or above pPool->ratio are never handed out and always stay set, so
+// a node has no free page left exactly when its low ratio bits are all clear.
+//
+static NvU64
+_poolRatioMask
+(
+    POOLALLOC *pPool
+)
+{
+    return (pPool->ratio >= 64) ? NV_U64_MAX : (NVBIT64(pPool->ratio) - 1);
+}
 
-// Local helpers.
-static NvU32
-ntz_64
+static NvBool
+_poolNodeIsFull
 (
-    NvU64 bits
+    POOLALLOC *pPool,
+    POOLNODE  *pNode
 )
 {
-    NvU64 bz, b5, b4, b3, b2, b1, b0;
-    NvU64 y;
-
-    y = bits & (~bits+1);
-    bz = y ? 0 : 1;
-    b5 = (y & 0x00000000FFFFFFFFULL) ? 0 : 32;
-    b4 = (y & 0x0000FFFF0000FFFFULL) ? 0 : 16;
-    b3 = (y & 0x00FF00FF00FF00FFULL) ? 0 : 8;
-    b2 = (y & 0x0F0F0F0F0F0F0F0FULL) ? 0 : 4;
-    b1 = (y & 0x3333333333333333ULL) ? 0 : 2;
-    b0 = (y & 0x5555555555555555ULL) ? 0 : 1;
-
-    return ((NvU32)(bz + b5 + b4 + b3 + b2 + b1 + b0));
+    return (pNode->bitmap & _poolRatioMask(pPool)) == 0;
 }
 
 static void
@@ -64,18 +61,6 @@ _setBitmap
     *bitmap = ((*bitmap) | mask);
 }
 
-static NvU32
-countZeros
-(
-    NvU64 bits
-)
-{
-    // Flip the bits to covert zeros to ones.
-    bits = ~bits;
-    return nvPopCount64(bits);
-}
-
-
 static void
 poolListDestroy
 (
@@ -142,7 +127,7 @@ allocFreeList
     pFirstFree = listHead(&pPool->freeList);
     pFirstFree->bitmap = ~((NvU64)1);
 
-    if(ntz_64(pFirstFree->bitmap) >= pPool->ratio)
+    if (_poolNodeIsFull(pPool, pFirstFree))
     {
         // Move from partial list to full list
         listRemove(&pPool->freeList, pFirstFree);
@@ -173,12 +158,12 @@ allocPartialList
 
     pFirstPartial = listHead(&pPool->partialList);
     bitmap = pFirstPartial->bitmap;
-    freeIdx = ntz_64(bitmap);
+    freeIdx = portUtilCountTrailingZeros64(bitmap);
     mask = ~((NvU64)1 << freeIdx);
 
     NV_ASSERT(freeIdx < pPool->ratio);
     pFirstPartial->bitmap = bitmap & mask;
-    if(ntz_64(pFirstPartial->bitmap) >= pPool->ratio)
+    if (_poolNodeIsFull(pPool, pFirstPartial))
     {
         // Move from partial list to full list
         listRemove(&pPool->partialList, pFirstPartial);
@@ -500,12 +485,14 @@ poolFree
     POOLNODE *pNode;
     NvU32    freeIdx;
     NvU64    address, baseAddr;
+    NvBool   bWasFull;
 
     address = pPageHandle->address;
     pNode = (POOLNODE *) (pPageHandle->pMetadata);
     baseAddr = pNode->pageAddr;
 
     freeIdx = (NvU32)((address - baseAddr) / (pPool->allocPageSize));
+    bWasFull = _poolNodeIsFull(pPool, pNode);
     _setBitmap(&(pNode->bitmap), freeIdx);
 
 #if defined(DEBUG_VERBOSE)
@@ -513,7 +500,7 @@ poolFree
 #endif // defined(DEBUG_VERBOSE)
 
     // node was in full list and needs to move out of full list
-    if ((countZeros(pNode->bitmap) + 1) == pPool->ratio)
+    if (bWasFull)
     {
         listRemove(&pPool->fullList, pNode);
 
@@ -243,6 +243,7 @@ SRCS += ../common/nvswitch/kernel/flcn/v04/flcn0400_nvswitch.c
 SRCS += ../common/nvswitch/kernel/flcn/v05/flcn0501_nvswitch.c
 SRCS += ../common/nvswitch/kernel/flcn/v06/flcn0600_nvswitch.c
 SRCS += ../common/nvswitch/kernel/fsprpc_nvswitch.c
+SRCS += ../common/nvswitch/kernel/ingress_shadow_nvswitch.c
 SRCS += ../common/nvswitch/kernel/inforom/ifrbbx_nvswitch.c
 SRCS += ../common/nvswitch/kernel/inforom/ifrecc_nvswitch.c
 SRCS += ../common/nvswitch/kernel/inforom/ifrnvlink_nvswitch.c
@@ -968,6 +969,7 @@ SRCS += src/libraries/nvport/core/core.c
 SRCS += src/libraries/nvport/cpu/cpu_common.c
 SRCS += src/libraries/nvport/cpu/cpu_x86_amd64.c
 SRCS += src/libraries/nvport/crypto/crypto_random_xorshift.c
+SRCS += src/libraries/nvport/memory/memory_cache.c
 SRCS += src/libraries/nvport/memory/memory_tracking.c
 SRCS += src/libraries/nvport/memory/memory_unix_kernel_os.c
 SRCS += src/libraries/nvport/string/string_generic.c